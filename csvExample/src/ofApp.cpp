@@ -203,6 +203,7 @@ void ofApp::mouseDragged(int x, int y, int button){
 	//csvRecorder.insertRow(0, row); // insert at the top
 	//csvRecorder.setRow(4, row); // record to the 4th row
 	// csvRecorder.removeRow(0); // remove the first row
+	// (use an ofxCsvRollingTable to only keep the most recent rows)
 	
 	// Second method by just appending.
 //	csvRecorder.addRow();  // add an empty row
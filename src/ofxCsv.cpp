@@ -29,15 +29,25 @@
  */
 
 #include "ofxCsv.h"
+#include "ofxCsvTokenizer.h"
+#include "ofxCsvParse.h"
 
 #include "ofLog.h"
 #include "ofUtils.h"
 #include "ofFileUtils.h"
 
+#include <algorithm>
+#include <cstring>
+
 //--------------------------------------------------
 ofxCsv::ofxCsv() {
 	fieldSeparator = ",";
 	commentPrefix = "#";
+	nullTokens.push_back("");
+	strictMode = OFXCSV_STRICT_OFF;
+	strictMaxErrors = 100;
+	strictCols = -1;
+	numErrors = 0;
 }
 
 //--------------------------------------------------
@@ -74,8 +84,19 @@ bool ofxCsv::load(const string &path, const string &separator, const string &com
 	// open file & read each line
 	int lineCount = 0;
 	int maxCols = 0;
+	bool loaded = true;
+	errors.clear();
+	numErrors = 0;
+	ofxCsvTokenizer tokenizer(fieldSeparator);
+	size_t expectedCols = max(strictCols, 0);
 	ofBuffer buffer = ofBufferFromFile(file.getAbsolutePath());
-	for(auto line : buffer.getLines()) {
+	const char *begin = buffer.getData();
+	const char *end = begin + buffer.size();
+	const char *lineEnd = nullptr;
+	string line;
+	for(const char *start = begin, *next = begin; start < end; start = next) {
+		next = ofxCsvTokenizer::nextLine(start, end, lineEnd);
+		line.assign(start, lineEnd - start);
 		
 		// skip empty lines
 		if(line.empty()) {
@@ -94,6 +115,31 @@ bool ofxCsv::load(const string &path, const string &separator, const string &com
 		
 		// split line into separate files
 		vector<string> cols = fromRowString(line);
+		
+		// strict mode: only check rows with quotes or the wrong number of cols
+		if(strictMode != OFXCSV_STRICT_OFF) {
+			ofxCsvError error;
+			if(((expectedCols > 0 && cols.size() != expectedCols) ||
+			    memchr(line.data(), '"', line.size())) &&
+			   !tokenizer.validate(line.data(), line.size(), expectedCols, error)) {
+				error.line = lineCount + 1;
+				error.offset = (start - begin) + error.col - 1;
+				lineCount++;
+				bool keepLoading = addError(error);
+				if(strictMode == OFXCSV_STRICT_COLLECT) {
+					data.push_back(cols);
+					maxCols = max(maxCols, (int)cols.size());
+				}
+				if(!keepLoading) {
+					loaded = false;
+					break;
+				}
+				continue;
+			}
+			if(expectedCols == 0) {
+				expectedCols = cols.size();
+			}
+		}
 		data.push_back(cols);
 	
 		// calc maxium table cols
@@ -109,8 +155,11 @@ bool ofxCsv::load(const string &path, const string &separator, const string &com
 
 	ofLogVerbose("ofxCsv") << "Read " << lineCount << " lines from " << filePath;
 	ofLogVerbose("ofxCsv") << "Loaded a " << data.size() << "x" << maxCols << " table";
+	if(numErrors > 0) {
+		ofLogWarning("ofxCsv") << "Found " << numErrors << " malformed rows in " << filePath;
+	}
 	
-	return true;
+	return loaded;
 }
 
 //--------------------------------------------------
@@ -180,6 +229,14 @@ bool ofxCsv::save(const string &path, bool quote) {
 	return save(path, quote, fieldSeparator);
 }
 
+//--------------------------------------------------
+ofxCsvReader ofxCsv::rows() const {
+	ofxCsvReader reader;
+	reader.open(filePath, fieldSeparator, commentPrefix);
+	reader.setNumberFormat(numberFormat);
+	return reader;
+}
+
 //--------------------------------------------------
 bool ofxCsv::createFile(const string &path) {
 	ofLogVerbose("ofxCsv") << "Creating "  << path;
@@ -187,6 +244,30 @@ bool ofxCsv::createFile(const string &path) {
 	return file.create();
 }
 
+// STRICT MODE
+
+//--------------------------------------------------
+void ofxCsv::setStrict(ofxCsvStrictMode mode, size_t maxErrors, int cols) {
+	strictMode = mode;
+	strictMaxErrors = maxErrors;
+	strictCols = cols;
+}
+
+//--------------------------------------------------
+ofxCsvStrictMode ofxCsv::getStrict() const {
+	return strictMode;
+}
+
+//--------------------------------------------------
+const vector<ofxCsvError>& ofxCsv::getErrors() const {
+	return errors;
+}
+
+//--------------------------------------------------
+size_t ofxCsv::getNumErrors() const {
+	return numErrors;
+}
+
 /// DATA IO
 
 //--------------------------------------------------
@@ -378,6 +459,75 @@ bool ofxCsv::empty() const {
 	return data.empty();
 }
 
+// COMPUTED COLUMNS
+
+//--------------------------------------------------
+bool ofxCsv::addComputedColumn(const string &name, const string &expression,
+                               ofxCsvColumn<double> *values) {
+	if(data.empty()) {
+		ofLogError("ofxCsv") << "Cannot add computed column " << name << ": no header row";
+		return false;
+	}
+	ofxCsvExpression compiled;
+	if(!compiled.parse(expression)) {
+		return false;
+	}
+
+	// find & load the input cols
+	const vector<string> &variables = compiled.getVariables();
+	vector<ofxCsvColumn<double>> inputs(variables.size());
+	vector<const ofxCsvColumn<double>*> columns;
+	for(size_t i = 0; i < variables.size(); i++) {
+		const string &variable = variables[i];
+		int col = -1;
+		if(variable[0] == '$') {
+			ofxCsvParse::toInteger(variable.data() + 1, variable.data() + variable.size(), col);
+		}
+		else {
+			const vector<string> &header = data[0].getData();
+			auto found = find(header.begin(), header.end(), variable);
+			if(found != header.end()) {
+				col = found - header.begin();
+			}
+		}
+		if(col < 0) {
+			ofLogError("ofxCsv") << "Cannot add computed column " << name
+				<< ": no column named " << variable;
+			return false;
+		}
+		inputs[i].load(*this, col, 1);
+		columns.push_back(&inputs[i]);
+	}
+
+	ofxCsvColumn<double> results;
+	if(!compiled.evaluate(columns, data.size() - 1, results)) {
+		return false;
+	}
+
+	// append as the last col of every row
+	size_t col = 0;
+	for(auto &row : data) {
+		col = max(col, row.size());
+	}
+	const string null = nullTokens.empty() ? "" : nullTokens.front();
+	data[0].setString(col, name);
+	for(size_t i = 0; i < results.size(); i++) {
+		vector<string> &fields = data[i + 1].getData();
+		fields.resize(col + 1);
+		if(results.isNull(i)) {
+			fields[col] = null;
+		}
+		else {
+			fields[col].clear();
+			ofxCsvFormat::appendExact(fields[col], results[i]);
+		}
+	}
+	if(values) {
+		*values = std::move(results);
+	}
+	return true;
+}
+
 // UTIL
 
 //--------------------------------------------------
@@ -417,6 +567,44 @@ string ofxCsv::getComment() const {
 	return commentPrefix;
 }
 
+//--------------------------------------------------
+void ofxCsv::setNumberFormat(const ofxCsvNumberFormat &format) {
+	numberFormat = format;
+}
+
+//--------------------------------------------------
+ofxCsvNumberFormat ofxCsv::getNumberFormat() const {
+	return numberFormat;
+}
+
+//--------------------------------------------------
+void ofxCsv::setNullTokens(const vector<string> &tokens) {
+	nullTokens = tokens;
+}
+
+//--------------------------------------------------
+vector<string> ofxCsv::getNullTokens() const {
+	return nullTokens;
+}
+
+//--------------------------------------------------
+bool ofxCsv::isNullToken(const string &field) const {
+	for(auto &token : nullTokens) {
+		if(field == token) {
+			return true;
+		}
+	}
+	return false;
+}
+
+//--------------------------------------------------
+bool ofxCsv::isNull(int row, int col) const {
+	if(row < 0 || col < 0 || (size_t)row >= data.size() || (size_t)col >= data[row].size()) {
+		return true;
+	}
+	return isNullToken(*(data[row].begin() + col));
+}
+
 // PROTECTED
 
 //--------------------------------------------------
@@ -426,3 +614,26 @@ void ofxCsv::expandRow(int row, int cols) {
 	}
 	data[row].expand(cols);
 }
+
+//--------------------------------------------------
+bool ofxCsv::addError(const ofxCsvError &error) {
+	numErrors++;
+	if(errors.size() < strictMaxErrors) {
+		errors.push_back(error);
+	}
+	ofLogVerbose("ofxCsv") << "Malformed row in " << filePath << ": " << error;
+	switch(strictMode) {
+		case OFXCSV_STRICT_STOP:
+			ofLogError("ofxCsv") << "Stopped loading " << filePath << ": " << error;
+			return false;
+		case OFXCSV_STRICT_COLLECT:
+			if(numErrors >= strictMaxErrors) {
+				ofLogError("ofxCsv") << "Stopped loading " << filePath << ": "
+				                     << numErrors << " malformed rows";
+				return false;
+			}
+			return true;
+		default:
+			return true;
+	}
+}
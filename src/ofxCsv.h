@@ -31,6 +31,15 @@
 #pragma once
 
 #include "ofxCsvRow.h"
+#include "ofxCsvFormat.h"
+#include "ofxCsvMapping.h"
+#include "ofxCsvReader.h"
+#include "ofxCsvError.h"
+#include "ofxCsvColumn.h"
+#include "ofxCsvExpression.h"
+
+#include "ofLog.h"
+#include "ofFileUtils.h"
 
 /// \class ofxCsv
 /// \brief table data loaded from & saved to CSV (Character Separated Value) files
@@ -109,6 +118,22 @@ class ofxCsv {
 		/// \returns true if file saved successfully
 		bool save(const string &path="", bool quote=false);
 	
+		/// Read the current file row by row without loading it.
+		///
+		/// Uses the current file path, field separator & comment line
+		/// prefix. Rows are tokenized as they are reached, so looping can
+		/// stop early without reading the rest of the file:
+		///
+		///     for(auto &row : csv.rows()) {
+		///         if(row.getInt(0) > 100) {
+		///             break;
+		///         }
+		///     }
+		///
+		/// \returns a reader over the file rows, empty if the file couldn't
+		///          be opened
+		ofxCsvReader rows() const;
+
 		/// Create an empty CSV file.
 		///
 		/// Creates any required folders in the path, if needed.
@@ -117,6 +142,78 @@ class ofxCsv {
 		/// \returns true if file saved successfully
 		bool createFile(const string &path);
 	
+	/// \section Strict Mode
+
+		/// Set strict mode for checking rows when loading a CSV file.
+		///
+		/// Instead of silently accepting malformed rows, strict mode records
+		/// them with their line, col, & byte offset. Rows are only checked
+		/// in full when they contain quotes or have an unexpected number of
+		/// cols, so loading well formed files stays fast:
+		///
+		///     csv.setStrict(OFXCSV_STRICT_SKIP);
+		///     csv.load("data.csv");
+		///     for(auto &error : csv.getErrors()) {
+		///         ofLogWarning() << error;
+		///     }
+		///
+		/// When loading stops due to an error, the rows loaded so far are kept
+		/// & load() returns false.
+		///
+		/// \param mode Policy for malformed rows, default OFXCSV_STRICT_OFF.
+		/// \param maxErrors Max number of errors to record, OFXCSV_STRICT_COLLECT
+		///                  stops loading when it is reached.
+		/// \param cols Expected number of cols, -1 to use the first row's.
+		void setStrict(ofxCsvStrictMode mode, size_t maxErrors=100, int cols=-1);
+
+		/// Get the strict mode policy, default OFXCSV_STRICT_OFF.
+		ofxCsvStrictMode getStrict() const;
+
+		/// Get the errors recorded by the last load in strict mode.
+		const vector<ofxCsvError>& getErrors() const;
+
+		/// Get the number of errors found by the last load in strict mode,
+		/// which may be more than the number recorded.
+		size_t getNumErrors() const;
+
+	/// \section Struct Mapping
+
+		/// Load a CSV file straight into a vector of structs.
+		///
+		/// Fields are parsed into the struct members declared with
+		/// OFXCSV_MAPPING without building a table of row strings. Skips
+		/// empty lines & lines beginning with the comment prefix.
+		///
+		/// \param path File path to load.
+		/// \param header Is the first row a header with the col names?
+		/// \param separator Field separator string, default comma ",".
+		/// \param comment Comment line prefix string, default "#".
+		/// \param format Decimal mark & thousands separator for number
+		///               members, ie. ofxCsvNumberFormat(',', '.') for
+		///               "1.234,5" with a ";" separator.
+		/// \returns the loaded structs, empty on error
+		template<typename T>
+		static vector<T> loadAs(const string &path, bool header=true,
+		                        const string &separator=",", const string &comment="#",
+		                        const ofxCsvNumberFormat &format=ofxCsvNumberFormat());
+
+		/// Save a vector of structs straight to a CSV file.
+		///
+		/// Members declared with OFXCSV_MAPPING are formatted straight into
+		/// the file buffer without building a table of row strings. Floating
+		/// point members are written with enough digits to load back to the
+		/// same value. Creates any required folders in the path, if needed.
+		///
+		/// \param rows Structs to save.
+		/// \param path File path to save.
+		/// \param header Write a header row with the col names?
+		/// \param quote Should the fields be double quoted? default false.
+		/// \param separator Field separator string, default comma ",".
+		/// \returns true if file saved successfully
+		template<typename T>
+		static bool saveFrom(const vector<T> &rows, const string &path, bool header=true,
+		                     bool quote=false, const string &separator=",");
+
 	/// \section Data IO
 	
 		/// Load from a vector of rows.
@@ -135,7 +232,8 @@ class ofxCsv {
 	
 		/// Expand for the required number of rows and cols.
 		///
-		/// Fills any missing fields with empty strings.
+		/// Fills any missing fields with empty strings, which are null with
+		/// the default null tokens.
 		///
 		/// \param rows Required number of rows, minimum of 1.
 		/// \param cols Required number of cols, minimum of 1.
@@ -171,6 +269,20 @@ class ofxCsv {
 	
 		/// Add an empty row to the end.
 		void addRow();
+
+		/// Add a row of values to the end.
+		///
+		/// Each value is formatted straight into the new row's fields without
+		/// building an intermediate ofxCsvRow, ie.
+		///
+		///     csv.appendRow(x, y, 1.5f, "label");
+		///
+		/// Numbers are formatted like ofToString(), strings are added as is.
+		///
+		/// \param values Field values: numbers, bools, strings, or C strings.
+		/// \returns the new row
+		template<typename... Values>
+		ofxCsvRow& appendRow(const Values&... values);
 	
 		/// Set a row at a given position.
 		///
@@ -240,6 +352,28 @@ class ofxCsv {
 		/// \returns true if there is no row data.
 		bool empty() const;
 	
+	/// \section Computed Columns
+
+		/// Add a col computed from other cols, ie.
+		///
+		///     csv.addComputedColumn("speed", "sqrt(dx*dx + dy*dy)");
+		///
+		/// Row 0 is the header: variables name its cols, or use $2 for col 2.
+		/// The cols are parsed into typed columns once & the expression is
+		/// evaluated 1024 rows at a time, see ofxCsvExpression for the syntax.
+		///
+		/// Results are written into a new last col with enough digits to
+		/// parse back to the typed values. Rows where any input is null get
+		/// the first null token.
+		///
+		/// \param name Header name for the new col.
+		/// \param expression Expression over the other cols.
+		/// \param values Optional, set to the typed results, one per row after
+		///               the header.
+		/// \returns true if the col was added
+		bool addComputedColumn(const string &name, const string &expression,
+		                       ofxCsvColumn<double> *values=nullptr);
+
 	/// \section Util
 	
 		/// Trim leading & trailing whitespace from all non-quoted fields.
@@ -278,9 +412,51 @@ class ofxCsv {
 	
 		/// Get the current comment line prefix, default "#".
 		string getComment() const;
+
+		/// Set the decimal mark & thousands separator used when parsing
+		/// numbers from this table, ie. by rows(), ofxCsvColumn,
+		/// ofxCsvSpatialIndex, ofxCsvLut, & ofxCsvDownsampler, default
+		/// "1234.5":
+		///
+		///     csv.load("export.csv", ";");
+		///     csv.setNumberFormat(ofxCsvNumberFormat(',', '.')); // "1.234,5"
+		///
+		/// Rows don't know their table, so pass the format to
+		/// ofxCsvRow::getFloat(col, format) & getInt(col, format).
+		void setNumberFormat(const ofxCsvNumberFormat &format);
+
+		/// Get the number format, default "1234.5".
+		ofxCsvNumberFormat getNumberFormat() const;
+
+		/// Set the field strings which mean a missing value, default {""}.
+		///
+		/// Typed columns loaded from this table store these as nulls:
+		///
+		///     csv.setNullTokens({"", "NA", "null"});
+		///     ofxCsvColumn<double> values;
+		///     values.load(csv, 1);
+		///
+		void setNullTokens(const vector<string> &tokens);
+
+		/// Get the field strings which mean a missing value.
+		vector<string> getNullTokens() const;
+
+		/// Is a field string one of the null tokens?
+		bool isNullToken(const string &field) const;
+
+		/// Is a field missing or one of the null tokens?
+		///
+		/// \param row Row number.
+		/// \param col Column number.
+		/// \returns true if the field doesn't exist or is a null token
+		bool isNull(int row, int col) const;
 	
 	protected:
 	
+		/// Record an error found when loading in strict mode.
+		/// \returns true if loading should continue
+		bool addError(const ofxCsvError &error);
+
 		/// Expand to include a required row.
 		///
 		/// Fills any missing fields in this row with empty strings.
@@ -295,4 +471,114 @@ class ofxCsv {
 		string filePath;       //< Current file path
 		string fieldSeparator; //< Field separator, default: comma ","
 		string commentPrefix;  //< Comment line prefix, default: "#"
+		ofxCsvNumberFormat numberFormat; //< Number format, default: "1234.5"
+		vector<string> nullTokens; //< Missing value strings, default: {""}
+
+		ofxCsvStrictMode strictMode; //< Strict mode policy, default: off
+		size_t strictMaxErrors;      //< Max number of errors recorded
+		int strictCols;              //< Expected number of cols, -1 for first row's
+		vector<ofxCsvError> errors;  //< Errors recorded by the last load
+		size_t numErrors;            //< Errors found by the last load
 };
+
+// TEMPLATES
+
+//--------------------------------------------------
+template<typename... Values>
+ofxCsvRow& ofxCsv::appendRow(const Values&... values) {
+	data.push_back(ofxCsvRow());
+	vector<string> &fields = data.back().getData();
+	fields.resize(sizeof...(values));
+	size_t i = 0;
+	int unpack[] = {0, (ofxCsvFormat::append(fields[i++], values), 0)...};
+	(void)unpack;
+	return data.back();
+}
+
+//--------------------------------------------------
+template<typename T>
+vector<T> ofxCsv::loadAs(const string &path, bool header, const string &separator, const string &comment,
+                         const ofxCsvNumberFormat &format) {
+
+	vector<T> rows;
+	ofLogVerbose("ofxCsv") << "Loading " << path << " as structs";
+
+	// tokenize each row & parse fields straight into the members
+	ofxCsvReader reader;
+	if(!reader.open(path, separator, comment)) {
+		return rows;
+	}
+	auto members = ofxCsvMapping<T>::members();
+	vector<int> cols;
+	bool needHeader = header;
+	if(!needHeader && !ofxCsvMappingDetail::resolveCols<T>(nullptr, cols)) {
+		return rows;
+	}
+	for(auto &row : reader) {
+		if(needHeader) {
+			if(!ofxCsvMappingDetail::resolveCols<T>(&row.getFields(), cols)) {
+				return rows;
+			}
+			needHeader = false;
+			continue;
+		}
+		rows.emplace_back();
+		ofxCsvMappingDetail::parseRow(members, row.getFields(), cols, format, rows.back());
+	}
+
+	ofLogVerbose("ofxCsv") << "Loaded " << rows.size() << " structs from " << path;
+	return rows;
+}
+
+//--------------------------------------------------
+template<typename T>
+bool ofxCsv::saveFrom(const vector<T> &rows, const string &path, bool header, bool quote, const string &separator) {
+
+	ofLogVerbose("ofxCsv") << "Saving " << rows.size() << " structs to " << path;
+
+	// do some checks
+	ofFile file(ofToDataPath(path), ofFile::Reference);
+	if(!file.exists()) {
+		ofFile create(ofToDataPath(path), ofFile::WriteOnly, false);
+		if(!create.create()) {
+			ofLogError("ofxCsv") << "Could not save to " << path << ": couldn't create";
+			return false;
+		}
+	}
+	if(file.isDirectory()) {
+		ofLogError("ofxCsv") << "Cannot save " << path << ": \"file\" is actually a directory";
+		return false;
+	}
+	FILE *out = fopen(file.getAbsolutePath().c_str(), "wb");
+	if(!out) {
+		ofLogError("ofxCsv") << "Cannot save " << path << ": file not writable";
+		return false;
+	}
+
+	// format straight into a bounded buffer, flushing as it fills
+	static const size_t flushSize = 64 * 1024;
+	auto members = ofxCsvMapping<T>::members();
+	vector<int> cols = ofxCsvMappingDetail::saveCols<T>();
+	string buffer;
+	buffer.reserve(flushSize * 2);
+	if(header) {
+		ofxCsvMappingDetail::formatHeader(buffer, members, cols, quote, separator);
+	}
+	bool written = true;
+	for(auto &row : rows) {
+		ofxCsvMappingDetail::formatRow(buffer, members, row, cols, quote, separator);
+		if(buffer.size() >= flushSize) {
+			written = written && fwrite(buffer.data(), 1, buffer.size(), out) == buffer.size();
+			buffer.clear();
+		}
+	}
+	written = written && fwrite(buffer.data(), 1, buffer.size(), out) == buffer.size();
+	written = (fclose(out) == 0) && written;
+	if(!written) {
+		ofLogError("ofxCsv") << "Could not save to " << path << ": couldn't write";
+		return false;
+	}
+
+	ofLogVerbose("ofxCsv") << "Wrote " << rows.size() << " structs to " << path;
+	return true;
+}
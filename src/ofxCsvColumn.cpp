@@ -0,0 +1,418 @@
+/**
+ *  ofxCsvColumn.cpp
+ *  Inspired and based on Ben Fry's [table class](http://benfry.com/writing/map/Table.pde)
+ *
+ *  The MIT License
+ *
+ *  Copyright (c) 2011-2019 Paul Vollmer, https://paulvollmer.net
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ *
+ *  @modified           2026.10.18
+ *  @version            0.2.1
+ */
+
+#include "ofxCsvColumn.h"
+
+#include "ofxCsv.h"
+#include "ofxCsvParse.h"
+
+#include <cmath>
+#include <type_traits>
+
+/// parse an integer value
+template<typename T>
+static inline typename std::enable_if<std::is_integral<T>::value, bool>::type
+parseValue(const char *begin, const char *end, T &out, const ofxCsvNumberFormat &format) {
+	return ofxCsvParse::toInteger(begin, end, out, nullptr, format);
+}
+
+/// parse a float value
+static inline bool parseValue(const char *begin, const char *end, float &out, const ofxCsvNumberFormat &format) {
+	return ofxCsvParse::toFloat(begin, end, out, format);
+}
+
+/// parse a double value
+static inline bool parseValue(const char *begin, const char *end, double &out, const ofxCsvNumberFormat &format) {
+	return ofxCsvParse::toDouble(begin, end, out, format);
+}
+
+/// call f(index) for each set bit of the validity bitmap, whole words are
+/// looped over without checking bits
+template<typename F>
+static inline void forEachValid(const vector<uint64_t> &validity, size_t size, F &&f) {
+	for(size_t w = 0; w < validity.size(); w++) {
+		size_t start = w * 64;
+		size_t count = min<size_t>(64, size - start);
+		uint64_t bits = validity[w];
+		if(count == 64 && bits == ~0ULL) {
+			for(size_t i = start; i < start + 64; i++) {
+				f(i);
+			}
+		}
+		else if(bits != 0) {
+			for(size_t i = 0; i < count; i++) {
+				if(bits & (1ULL << i)) {
+					f(start + i);
+				}
+			}
+		}
+	}
+}
+
+//--------------------------------------------------
+template<typename T>
+const size_t ofxCsvColumn<T>::zoneSize;
+
+//--------------------------------------------------
+template<typename T>
+ofxCsvColumn<T>::ofxCsvColumn() {
+	numNulls = 0;
+}
+
+/// LOADING
+
+//--------------------------------------------------
+template<typename T>
+size_t ofxCsvColumn<T>::load(const ofxCsv &csv, int col, int firstRow) {
+	clear();
+	firstRow = max(firstRow, 0);
+	reserve(csv.getNumRows() > (size_t)firstRow ? csv.getNumRows() - firstRow : 0);
+	ofxCsvNumberFormat format = csv.getNumberFormat();
+	size_t index = 0;
+	for(auto &row : csv) {
+		if(index++ < (size_t)firstRow) {
+			continue;
+		}
+		T value = T();
+		if(col >= 0 && (size_t)col < row.size()) {
+			const string &text = *(row.begin() + col);
+			if(!csv.isNullToken(text) && parseValue(text.data(), text.data() + text.size(), value, format)) {
+				push(value);
+				continue;
+			}
+		}
+		pushNull();
+	}
+	return values.size() - numNulls;
+}
+
+//--------------------------------------------------
+template<typename T>
+void ofxCsvColumn<T>::push(T value) {
+	if(values.size() % 64 == 0) {
+		validity.push_back(0);
+	}
+	validity.back() |= 1ULL << (values.size() % 64);
+	values.push_back(value);
+	addToZone(values.size() - 1, value);
+}
+
+//--------------------------------------------------
+template<typename T>
+void ofxCsvColumn<T>::pushNull() {
+	if(values.size() % 64 == 0) {
+		validity.push_back(0);
+	}
+	values.push_back(T());
+	numNulls++;
+	if(zones.size() * zoneSize < values.size()) {
+		zones.push_back(Zone{T(), T(), false});
+	}
+}
+
+//--------------------------------------------------
+template<typename T>
+void ofxCsvColumn<T>::set(size_t index, T value) {
+	expand(index + 1);
+	uint64_t bit = 1ULL << (index % 64);
+	if(!(validity[index / 64] & bit)) {
+		validity[index / 64] |= bit;
+		numNulls--;
+	}
+	values[index] = value;
+	addToZone(index, value);
+}
+
+//--------------------------------------------------
+template<typename T>
+void ofxCsvColumn<T>::setNull(size_t index) {
+	expand(index + 1);
+	uint64_t bit = 1ULL << (index % 64);
+	if(validity[index / 64] & bit) {
+		validity[index / 64] &= ~bit;
+		numNulls++;
+	}
+	values[index] = T();
+}
+
+//--------------------------------------------------
+template<typename T>
+void ofxCsvColumn<T>::reserve(size_t size) {
+	values.reserve(size);
+	validity.reserve((size + 63) / 64);
+}
+
+//--------------------------------------------------
+template<typename T>
+void ofxCsvColumn<T>::clear() {
+	values.clear();
+	validity.clear();
+	numNulls = 0;
+	zones.clear();
+}
+
+/// ACCESS
+
+//--------------------------------------------------
+template<typename T>
+T ofxCsvColumn<T>::get(size_t index, T fallback) const {
+	return isNull(index) ? fallback : values[index];
+}
+
+//--------------------------------------------------
+template<typename T>
+bool ofxCsvColumn<T>::isNull(size_t index) const {
+	return index >= values.size() || !(validity[index / 64] & (1ULL << (index % 64)));
+}
+
+//--------------------------------------------------
+template<typename T>
+T ofxCsvColumn<T>::operator[](size_t index) const {
+	return values[index];
+}
+
+//--------------------------------------------------
+template<typename T>
+size_t ofxCsvColumn<T>::size() const {
+	return values.size();
+}
+
+//--------------------------------------------------
+template<typename T>
+bool ofxCsvColumn<T>::empty() const {
+	return values.empty();
+}
+
+//--------------------------------------------------
+template<typename T>
+size_t ofxCsvColumn<T>::getNumNulls() const {
+	return numNulls;
+}
+
+//--------------------------------------------------
+template<typename T>
+size_t ofxCsvColumn<T>::getNumValid() const {
+	return values.size() - numNulls;
+}
+
+//--------------------------------------------------
+template<typename T>
+const vector<T>& ofxCsvColumn<T>::getValues() const {
+	return values;
+}
+
+//--------------------------------------------------
+template<typename T>
+const vector<uint64_t>& ofxCsvColumn<T>::getValidity() const {
+	return validity;
+}
+
+/// AGGREGATION
+
+//--------------------------------------------------
+template<typename T>
+double ofxCsvColumn<T>::getSum() const {
+	// null slots hold 0 so no need to check the bitmap
+	double sum = 0;
+	for(T v : values) {
+		sum += (double)v;
+	}
+	return sum;
+}
+
+//--------------------------------------------------
+template<typename T>
+double ofxCsvColumn<T>::getMean() const {
+	size_t count = getNumValid();
+	return count > 0 ? getSum() / count : NAN;
+}
+
+//--------------------------------------------------
+template<typename T>
+bool ofxCsvColumn<T>::getMin(T &out) const {
+	if(getNumValid() == 0) {
+		return false;
+	}
+	bool found = false;
+	T m = T();
+	forEachValid(validity, values.size(), [&](size_t i) {
+		if(!found || values[i] < m) {
+			m = values[i];
+			found = true;
+		}
+	});
+	out = m;
+	return true;
+}
+
+//--------------------------------------------------
+template<typename T>
+bool ofxCsvColumn<T>::getMax(T &out) const {
+	if(getNumValid() == 0) {
+		return false;
+	}
+	bool found = false;
+	T m = T();
+	forEachValid(validity, values.size(), [&](size_t i) {
+		if(!found || values[i] > m) {
+			m = values[i];
+			found = true;
+		}
+	});
+	out = m;
+	return true;
+}
+
+/// RANGE QUERIES
+
+//--------------------------------------------------
+template<typename T>
+size_t ofxCsvColumn<T>::findRange(T low, T high, vector<size_t> &rows) const {
+	rows.clear();
+	forEachInRange(low, high, [&](size_t i) {
+		rows.push_back(i);
+	});
+	return rows.size();
+}
+
+//--------------------------------------------------
+template<typename T>
+size_t ofxCsvColumn<T>::countRange(T low, T high) const {
+	size_t count = 0;
+	forEachInRange(low, high, [&](size_t) {
+		count++;
+	});
+	return count;
+}
+
+//--------------------------------------------------
+template<typename T>
+size_t ofxCsvColumn<T>::getNumZones() const {
+	return zones.size();
+}
+
+//--------------------------------------------------
+template<typename T>
+bool ofxCsvColumn<T>::getZone(size_t zone, T &min, T &max) const {
+	if(zone >= zones.size() || !zones[zone].used) {
+		return false;
+	}
+	min = zones[zone].min;
+	max = zones[zone].max;
+	return true;
+}
+
+//--------------------------------------------------
+template<typename T>
+void ofxCsvColumn<T>::updateZones() {
+	zones.assign((values.size() + zoneSize - 1) / zoneSize, Zone{T(), T(), false});
+	forEachValid(validity, values.size(), [&](size_t i) {
+		addToZone(i, values[i]);
+	});
+}
+
+// PROTECTED
+
+//--------------------------------------------------
+template<typename T>
+void ofxCsvColumn<T>::expand(size_t size) {
+	if(size <= values.size()) {
+		return;
+	}
+	numNulls += size - values.size();
+	values.resize(size, T());
+	validity.resize((size + 63) / 64, 0);
+	zones.resize((size + zoneSize - 1) / zoneSize, Zone{T(), T(), false});
+}
+
+//--------------------------------------------------
+template<typename T>
+void ofxCsvColumn<T>::addToZone(size_t index, T value) {
+	size_t z = index / zoneSize;
+	if(z >= zones.size()) {
+		zones.resize(z + 1, Zone{T(), T(), false});
+	}
+	if(value != value) { // NaN never matches a range
+		return;
+	}
+	Zone &zone = zones[z];
+	if(!zone.used) {
+		zone.min = zone.max = value;
+		zone.used = true;
+	}
+	else if(value < zone.min) {
+		zone.min = value;
+	}
+	else if(value > zone.max) {
+		zone.max = value;
+	}
+}
+
+//--------------------------------------------------
+template<typename T>
+template<typename F>
+void ofxCsvColumn<T>::forEachInRange(T low, T high, F &&f) const {
+	for(size_t z = 0; z < zones.size(); z++) {
+		const Zone &zone = zones[z];
+		if(!zone.used || zone.max < low || zone.min > high) {
+			continue;
+		}
+		size_t start = z * zoneSize, end = min(values.size(), start + zoneSize);
+		if(low <= zone.min && zone.max <= high) { // whole zone matches
+			for(size_t i = start; i < end; i++) {
+				if(!isNull(i) && values[i] == values[i]) {
+					f(i);
+				}
+			}
+			continue;
+		}
+		for(size_t i = start; i < end; i++) {
+			if(values[i] >= low && values[i] <= high && !isNull(i)) {
+				f(i);
+			}
+		}
+	}
+}
+
+// instantiate for the standard integer & floating point types, which the
+// fixed width types are aliases of
+template class ofxCsvColumn<char>;
+template class ofxCsvColumn<signed char>;
+template class ofxCsvColumn<unsigned char>;
+template class ofxCsvColumn<short>;
+template class ofxCsvColumn<unsigned short>;
+template class ofxCsvColumn<int>;
+template class ofxCsvColumn<unsigned int>;
+template class ofxCsvColumn<long>;
+template class ofxCsvColumn<unsigned long>;
+template class ofxCsvColumn<long long>;
+template class ofxCsvColumn<unsigned long long>;
+template class ofxCsvColumn<float>;
+template class ofxCsvColumn<double>;
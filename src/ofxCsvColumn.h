@@ -0,0 +1,204 @@
+/**
+ *  ofxCsvColumn.h
+ *  Inspired and based on Ben Fry's [table class](http://benfry.com/writing/map/Table.pde)
+ *
+ *  The MIT License
+ *
+ *  Copyright (c) 2011-2019 Paul Vollmer, https://paulvollmer.net
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ *
+ *  @modified           2026.10.18
+ *  @version            0.2.1
+ */
+
+#pragma once
+
+#include "ofConstants.h"
+
+class ofxCsv;
+
+/// \class ofxCsvColumn
+/// \brief typed column of numbers with a validity bitmap for nulls
+///
+/// Stores parsed values contiguously with one validity bit per row, so
+/// missing cells are distinct from zeros & aggregations skip them without
+/// parsing or comparing strings:
+///
+///     ofxCsv csv;
+///     csv.load("sensors.csv");
+///     csv.setNullTokens({"", "NA", "null"});
+///
+///     ofxCsvColumn<float> temperature;
+///     temperature.load(csv, 2, 1); // col 2, skip header row
+///     float mean = temperature.getMean(); // ignores "NA" cells
+///
+/// Null slots hold T() so the raw values can be summed or copied as is.
+/// T can be any standard integer type, float, or double.
+///
+/// The min & max of every 4096 values are kept as zone maps while loading &
+/// appending, so range queries skip zones which can't match. Sorted or
+/// clustered data, ie. times or ids, then only touches a few zones:
+///
+///     vector<size_t> rows;
+///     temperature.findRange(30, std::numeric_limits<float>::max(), rows);
+///
+template<typename T>
+class ofxCsvColumn {
+
+	public:
+
+		/// number of values per zone map entry
+		static const size_t zoneSize = 4096;
+
+		/// Constructor.
+		ofxCsvColumn();
+
+	/// \section Loading
+
+		/// Load a col from a table.
+		///
+		/// Clears any current values. Uses the table's number format & null
+		/// tokens, missing cells & cells which can't be parsed are null.
+		///
+		/// \param csv Table to load from.
+		/// \param col Column number.
+		/// \param firstRow First row to load, ie. 1 to skip a header row.
+		/// \returns the number of non-null values loaded
+		size_t load(const ofxCsv &csv, int col, int firstRow=0);
+
+		/// Add a value to the end.
+		void push(T value);
+
+		/// Add a null to the end.
+		void pushNull();
+
+		/// Set the value at an index, expands to fit.
+		void set(size_t index, T value);
+
+		/// Set a null at an index, expands to fit.
+		void setNull(size_t index);
+
+		/// Reserve space for a number of values.
+		void reserve(size_t size);
+
+		/// Clear all values.
+		void clear();
+
+	/// \section Access
+
+		/// Get the value at an index.
+		/// \returns the value or fallback if null or out of range
+		T get(size_t index, T fallback=T()) const;
+
+		/// Is the value at an index null? Out of range values are null.
+		bool isNull(size_t index) const;
+
+		/// Raw value access, null slots hold T().
+		T operator[](size_t index) const;
+
+		/// Get the number of values including nulls.
+		size_t size() const;
+
+		/// Is the column empty?
+		bool empty() const;
+
+		/// Get the number of nulls.
+		size_t getNumNulls() const;
+
+		/// Get the number of non-null values.
+		size_t getNumValid() const;
+
+		/// Get the raw values, null slots hold T().
+		const vector<T>& getValues() const;
+
+		/// Get the validity bitmap, bit i % 64 of word i / 64 is set for
+		/// non-null values.
+		const vector<uint64_t>& getValidity() const;
+
+	/// \section Aggregation
+
+		/// Get the sum of the non-null values as a double.
+		double getSum() const;
+
+		/// Get the mean of the non-null values.
+		/// \returns the mean or NaN if all values are null
+		double getMean() const;
+
+		/// Get the min non-null value.
+		/// \returns false if all values are null
+		bool getMin(T &out) const;
+
+		/// Get the max non-null value.
+		/// \returns false if all values are null
+		bool getMax(T &out) const;
+
+	/// \section Range Queries
+
+		/// Find the non-null values within a range, skipping zones whose
+		/// min & max are outside it.
+		///
+		/// \param low Min value, inclusive.
+		/// \param high Max value, inclusive.
+		/// \param rows Cleared & set to the matching indices in order.
+		/// \returns the number of matching values
+		size_t findRange(T low, T high, vector<size_t> &rows) const;
+
+		/// Count the non-null values within a range, skipping zones like
+		/// findRange().
+		size_t countRange(T low, T high) const;
+
+		/// Get the number of zones.
+		size_t getNumZones() const;
+
+		/// Get the min & max of a zone's values.
+		///
+		/// Bounds may be loose after values are replaced by set() or
+		/// setNull(), see updateZones().
+		///
+		/// \returns false if the zone has no non-null values
+		bool getZone(size_t zone, T &min, T &max) const;
+
+		/// Recompute exact zone bounds after replacing values.
+		void updateZones();
+
+	protected:
+
+		/// zone map entry, the bounds of zoneSize values
+		struct Zone {
+			T min;     //< min non-null value
+			T max;     //< max non-null value
+			bool used; //< are there any non-null values?
+		};
+
+		/// expand to fit an index, new slots are null
+		void expand(size_t size);
+
+		/// widen a zone's bounds to include a value
+		void addToZone(size_t index, T value);
+
+		/// call f(index) for each matching index in zones overlapping a range
+		template<typename F>
+		void forEachInRange(T low, T high, F &&f) const;
+
+		vector<T> values;          //< values, T() for nulls
+		vector<uint64_t> validity; //< validity bitmap, 1 bit per value
+		size_t numNulls;           //< number of nulls
+		vector<Zone> zones;        //< zone maps, 1 per zoneSize values
+};
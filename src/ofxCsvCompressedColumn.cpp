@@ -0,0 +1,467 @@
+/**
+ *  ofxCsvCompressedColumn.cpp
+ *  Inspired and based on Ben Fry's [table class](http://benfry.com/writing/map/Table.pde)
+ *
+ *  The MIT License
+ *
+ *  Copyright (c) 2011-2019 Paul Vollmer, https://paulvollmer.net
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ *
+ *  @modified           2026.10.18
+ *  @version            0.2.1
+ */
+
+#include "ofxCsvCompressedColumn.h"
+
+#include <cstring>
+#include <type_traits>
+
+/// no block is cached
+static const size_t s_noBlock = (size_t)-1;
+
+/// count the leading zero bits of a non-zero value
+static inline unsigned int countLeadingZeros(uint64_t v) {
+#if defined(__GNUC__) || defined(__clang__)
+	return __builtin_clzll(v);
+#else
+	unsigned int count = 0;
+	for(uint64_t bit = 1ULL << 63; !(v & bit); bit >>= 1) {
+		count++;
+	}
+	return count;
+#endif
+}
+
+/// count the trailing zero bits of a non-zero value
+static inline unsigned int countTrailingZeros(uint64_t v) {
+#if defined(__GNUC__) || defined(__clang__)
+	return __builtin_ctzll(v);
+#else
+	unsigned int count = 0;
+	for(; !(v & 1); v >>= 1) {
+		count++;
+	}
+	return count;
+#endif
+}
+
+/// number of bits needed to store a value
+static inline unsigned int bitWidth(uint64_t v) {
+	return v ? 64 - countLeadingZeros(v) : 0;
+}
+
+/// appends bit fields to packed words, least significant bits first
+struct BitWriter {
+	vector<uint64_t> &words;
+	size_t bit;
+	BitWriter(vector<uint64_t> &words) : words(words), bit(words.size() * 64) {}
+	inline void write(uint64_t v, unsigned int bits) {
+		if(bits == 0) {
+			return;
+		}
+		if(bits < 64) {
+			v &= (1ULL << bits) - 1;
+		}
+		size_t offset = bit % 64;
+		if(offset == 0) {
+			words.push_back(v);
+		}
+		else {
+			words.back() |= v << offset;
+			if(offset + bits > 64) {
+				words.push_back(v >> (64 - offset));
+			}
+		}
+		bit += bits;
+	}
+};
+
+/// reads bit fields from packed words
+struct BitReader {
+	const uint64_t *words;
+	size_t bit;
+	BitReader(const uint64_t *words) : words(words), bit(0) {}
+	inline uint64_t read(unsigned int bits) {
+		if(bits == 0) {
+			return 0;
+		}
+		size_t index = bit / 64, offset = bit % 64;
+		uint64_t v = words[index] >> offset;
+		if(offset + bits > 64) {
+			v |= words[index + 1] << (64 - offset);
+		}
+		bit += bits;
+		return (bits < 64) ? v & ((1ULL << bits) - 1) : v;
+	}
+};
+
+/// map an integer to an unsigned key with the same order
+template<typename T>
+static inline uint64_t toKey(T v) {
+	return std::is_signed<T>::value ? (uint64_t)(int64_t)v ^ (1ULL << 63) : (uint64_t)v;
+}
+
+/// map an unsigned key back to an integer
+template<typename T>
+static inline T fromKey(uint64_t key) {
+	return std::is_signed<T>::value ? (T)(int64_t)(key ^ (1ULL << 63)) : (T)key;
+}
+
+/// get the bits of a float or double
+template<typename T>
+static inline uint64_t toBits(T v) {
+	typename std::conditional<sizeof(T) == 4, uint32_t, uint64_t>::type bits;
+	memcpy(&bits, &v, sizeof(T));
+	return bits;
+}
+
+/// get a float or double from its bits
+template<typename T>
+static inline T fromBits(uint64_t v) {
+	typename std::conditional<sizeof(T) == 4, uint32_t, uint64_t>::type bits = v;
+	T out;
+	memcpy(&out, &bits, sizeof(T));
+	return out;
+}
+
+/// bit pack integers as offsets from the min or as zigzag deltas
+template<typename T, typename B>
+static typename std::enable_if<std::is_integral<T>::value>::type
+encodeBlock(const T *values, size_t count, vector<uint64_t> &words, B &block) {
+	uint64_t low = ~0ULL, high = 0, maxDelta = 0;
+	uint64_t previous = toKey(values[0]);
+	for(size_t i = 0; i < count; i++) {
+		uint64_t key = toKey(values[i]);
+		low = min(low, key);
+		high = max(high, key);
+		uint64_t delta = key - previous;
+		maxDelta = max(maxDelta, (delta << 1) ^ (uint64_t)((int64_t)delta >> 63));
+		previous = key;
+	}
+	BitWriter writer(words);
+	unsigned int referenceWidth = bitWidth(high - low), deltaWidth = bitWidth(maxDelta);
+	if(referenceWidth <= deltaWidth) {
+		block.encoding = B::FRAME_OF_REFERENCE;
+		block.width = referenceWidth;
+		block.reference = low;
+		for(size_t i = 0; i < count; i++) {
+			writer.write(toKey(values[i]) - low, referenceWidth);
+		}
+	}
+	else {
+		block.encoding = B::DELTA;
+		block.width = deltaWidth;
+		block.reference = toKey(values[0]);
+		for(size_t i = 1; i < count; i++) {
+			uint64_t delta = toKey(values[i]) - toKey(values[i-1]);
+			writer.write((delta << 1) ^ (uint64_t)((int64_t)delta >> 63), deltaWidth);
+		}
+	}
+}
+
+/// decode bit packed integers
+template<typename T, typename B>
+static typename std::enable_if<std::is_integral<T>::value>::type
+decodeBlock(const uint64_t *words, size_t count, const B &block, T *out) {
+	BitReader reader(words);
+	if(block.encoding == B::FRAME_OF_REFERENCE) {
+		for(size_t i = 0; i < count; i++) {
+			out[i] = fromKey<T>(block.reference + reader.read(block.width));
+		}
+	}
+	else {
+		uint64_t key = block.reference;
+		out[0] = fromKey<T>(key);
+		for(size_t i = 1; i < count; i++) {
+			uint64_t zigzag = reader.read(block.width);
+			key += (zigzag >> 1) ^ (0 - (zigzag & 1));
+			out[i] = fromKey<T>(key);
+		}
+	}
+}
+
+/// XOR compress floats with the previous value: a 0 bit for repeats,
+/// otherwise the meaningful bits within the previous leading & trailing
+/// zero window, or a new window with 5 bits of leading zeros & 6 bits of
+/// length
+template<typename T, typename B>
+static typename std::enable_if<std::is_floating_point<T>::value>::type
+encodeBlock(const T *values, size_t count, vector<uint64_t> &words, B &block) {
+	const unsigned int size = sizeof(T) * 8;
+	block.encoding = B::XOR;
+	block.width = size;
+	block.reference = 0;
+	BitWriter writer(words);
+	uint64_t previous = toBits(values[0]);
+	writer.write(previous, size);
+	unsigned int leading = 0, trailing = 0;
+	bool window = false;
+	for(size_t i = 1; i < count; i++) {
+		uint64_t bits = toBits(values[i]);
+		uint64_t x = bits ^ previous;
+		previous = bits;
+		if(x == 0) {
+			writer.write(0, 1);
+			continue;
+		}
+		unsigned int lead = min(countLeadingZeros(x) - (64 - size), 31u);
+		unsigned int trail = countTrailingZeros(x);
+		if(window && lead >= leading && trail >= trailing) {
+			writer.write(0x1, 2); // 1, 0
+			writer.write(x >> trailing, size - leading - trailing);
+		}
+		else {
+			unsigned int length = size - lead - trail;
+			writer.write(0x3, 2); // 1, 1
+			writer.write(lead, 5);
+			writer.write(length - 1, 6);
+			writer.write(x >> trail, length);
+			leading = lead;
+			trailing = trail;
+			window = true;
+		}
+	}
+}
+
+/// decode XOR compressed floats
+template<typename T, typename B>
+static typename std::enable_if<std::is_floating_point<T>::value>::type
+decodeBlock(const uint64_t *words, size_t count, const B &, T *out) {
+	const unsigned int size = sizeof(T) * 8;
+	BitReader reader(words);
+	uint64_t bits = reader.read(size);
+	out[0] = fromBits<T>(bits);
+	unsigned int leading = 0, trailing = 0;
+	for(size_t i = 1; i < count; i++) {
+		if(reader.read(1)) {
+			if(reader.read(1)) { // new window
+				leading = (unsigned int)reader.read(5);
+				unsigned int length = (unsigned int)reader.read(6) + 1;
+				trailing = size - leading - length;
+			}
+			bits ^= reader.read(size - leading - trailing) << trailing;
+		}
+		out[i] = fromBits<T>(bits);
+	}
+}
+
+//--------------------------------------------------
+template<typename T>
+const size_t ofxCsvCompressedColumn<T>::blockSize;
+
+//--------------------------------------------------
+template<typename T>
+ofxCsvCompressedColumn<T>::ofxCsvCompressedColumn() {
+	numNulls = 0;
+	previous = T();
+	cacheBlock = s_noBlock;
+}
+
+/// BUILDING
+
+//--------------------------------------------------
+template<typename T>
+void ofxCsvCompressedColumn<T>::compress(const ofxCsvColumn<T> &column) {
+	clear();
+	const vector<T> &values = column.getValues();
+	for(size_t i = 0; i < values.size(); i++) {
+		if(column.isNull(i)) {
+			pushNull();
+		}
+		else {
+			push(values[i]);
+		}
+	}
+	words.shrink_to_fit();
+}
+
+//--------------------------------------------------
+template<typename T>
+void ofxCsvCompressedColumn<T>::decompress(ofxCsvColumn<T> &column) const {
+	column.clear();
+	column.reserve(size());
+	vector<T> values;
+	for(size_t b = 0; getBlock(b, values); b++) {
+		size_t start = b * blockSize;
+		for(size_t i = 0; i < values.size(); i++) {
+			if(isNull(start + i)) {
+				column.pushNull();
+			}
+			else {
+				column.push(values[i]);
+			}
+		}
+	}
+}
+
+//--------------------------------------------------
+template<typename T>
+void ofxCsvCompressedColumn<T>::push(T value) {
+	size_t index = size();
+	if(index % 64 == 0) {
+		validity.push_back(0);
+	}
+	validity.back() |= 1ULL << (index % 64);
+	tail.push_back(value);
+	previous = value;
+	if(tail.size() == blockSize) {
+		compressTail();
+	}
+}
+
+//--------------------------------------------------
+template<typename T>
+void ofxCsvCompressedColumn<T>::pushNull() {
+	if(size() % 64 == 0) {
+		validity.push_back(0);
+	}
+	tail.push_back(previous); // repeat the last value so it packs well
+	numNulls++;
+	if(tail.size() == blockSize) {
+		compressTail();
+	}
+}
+
+//--------------------------------------------------
+template<typename T>
+void ofxCsvCompressedColumn<T>::clear() {
+	blocks.clear();
+	words.clear();
+	tail.clear();
+	validity.clear();
+	numNulls = 0;
+	previous = T();
+	cache.clear();
+	cacheBlock = s_noBlock;
+}
+
+/// ACCESS
+
+//--------------------------------------------------
+template<typename T>
+T ofxCsvCompressedColumn<T>::get(size_t index, T fallback) const {
+	if(isNull(index)) {
+		return fallback;
+	}
+	size_t block = index / blockSize;
+	if(block == blocks.size()) {
+		return tail[index % blockSize];
+	}
+	if(block != cacheBlock) {
+		cache.resize(blockSize);
+		decodeBlock(block, cache.data());
+		cacheBlock = block;
+	}
+	return cache[index % blockSize];
+}
+
+//--------------------------------------------------
+template<typename T>
+bool ofxCsvCompressedColumn<T>::isNull(size_t index) const {
+	return index >= size() || !(validity[index / 64] & (1ULL << (index % 64)));
+}
+
+//--------------------------------------------------
+template<typename T>
+bool ofxCsvCompressedColumn<T>::getBlock(size_t block, vector<T> &out) const {
+	if(block < blocks.size()) {
+		out.resize(blockSize);
+		decodeBlock(block, out.data());
+	}
+	else if(block == blocks.size() && !tail.empty()) {
+		out = tail;
+	}
+	else {
+		out.clear();
+		return false;
+	}
+	size_t start = block * blockSize;
+	for(size_t i = 0; i < out.size(); i++) {
+		if(isNull(start + i)) {
+			out[i] = T();
+		}
+	}
+	return true;
+}
+
+//--------------------------------------------------
+template<typename T>
+size_t ofxCsvCompressedColumn<T>::size() const {
+	return blocks.size() * blockSize + tail.size();
+}
+
+//--------------------------------------------------
+template<typename T>
+bool ofxCsvCompressedColumn<T>::empty() const {
+	return size() == 0;
+}
+
+//--------------------------------------------------
+template<typename T>
+size_t ofxCsvCompressedColumn<T>::getNumBlocks() const {
+	return blocks.size() + (tail.empty() ? 0 : 1);
+}
+
+//--------------------------------------------------
+template<typename T>
+size_t ofxCsvCompressedColumn<T>::getNumNulls() const {
+	return numNulls;
+}
+
+//--------------------------------------------------
+template<typename T>
+size_t ofxCsvCompressedColumn<T>::getNumBytes() const {
+	return blocks.size() * sizeof(Block) + words.size() * sizeof(uint64_t) +
+	       tail.capacity() * sizeof(T) + validity.size() * sizeof(uint64_t);
+}
+
+// PROTECTED
+
+//--------------------------------------------------
+template<typename T>
+void ofxCsvCompressedColumn<T>::compressTail() {
+	Block block;
+	block.offset = words.size();
+	encodeBlock(tail.data(), tail.size(), words, block);
+	blocks.push_back(block);
+	tail.clear();
+}
+
+//--------------------------------------------------
+template<typename T>
+void ofxCsvCompressedColumn<T>::decodeBlock(size_t block, T *out) const {
+	::decodeBlock(words.data() + blocks[block].offset, blockSize, blocks[block], out);
+}
+
+// instantiate for the standard integer & floating point types, which the
+// fixed width types are aliases of
+template class ofxCsvCompressedColumn<char>;
+template class ofxCsvCompressedColumn<signed char>;
+template class ofxCsvCompressedColumn<unsigned char>;
+template class ofxCsvCompressedColumn<short>;
+template class ofxCsvCompressedColumn<unsigned short>;
+template class ofxCsvCompressedColumn<int>;
+template class ofxCsvCompressedColumn<unsigned int>;
+template class ofxCsvCompressedColumn<long>;
+template class ofxCsvCompressedColumn<unsigned long>;
+template class ofxCsvCompressedColumn<long long>;
+template class ofxCsvCompressedColumn<unsigned long long>;
+template class ofxCsvCompressedColumn<float>;
+template class ofxCsvCompressedColumn<double>;
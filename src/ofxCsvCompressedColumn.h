@@ -0,0 +1,148 @@
+/**
+ *  ofxCsvCompressedColumn.h
+ *  Inspired and based on Ben Fry's [table class](http://benfry.com/writing/map/Table.pde)
+ *
+ *  The MIT License
+ *
+ *  Copyright (c) 2011-2019 Paul Vollmer, https://paulvollmer.net
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ *
+ *  @modified           2026.10.18
+ *  @version            0.2.1
+ */
+
+#pragma once
+
+#include "ofxCsvColumn.h"
+
+/// \class ofxCsvCompressedColumn
+/// \brief append only typed column compressed in blocks of 1024 values
+///
+/// An opt-in in-memory format for long recordings, instead of keeping
+/// numbers as decimal strings or full width values:
+///   * Integers are bit packed per block either as offsets from the block
+///     min (frame of reference) or as zigzag deltas from the previous value,
+///     whichever is smaller, ie. 10 bit sensor values or slowly increasing
+///     counters & times take 1-10 bits each.
+///   * Floats & doubles are XOR compressed against the previous value like
+///     Facebook's Gorilla, ie. slowly changing readings take 1-20 bits each.
+///
+///     ofxCsvCompressedColumn<float> temperature;
+///     temperature.push(21.5f); // as values arrive
+///     ...
+///     float t = temperature.get(i); // decodes & caches i's block
+///
+/// Values are appended to an uncompressed tail block which is compressed
+/// once full. Nulls are kept in a validity bitmap like ofxCsvColumn. Access
+/// decodes one block at a time into a cache, so reading isn't thread safe.
+///
+template<typename T>
+class ofxCsvCompressedColumn {
+
+	public:
+
+		/// number of values per compressed block
+		static const size_t blockSize = 1024;
+
+		/// Constructor.
+		ofxCsvCompressedColumn();
+
+	/// \section Building
+
+		/// Compress a typed column, clears any current values.
+		void compress(const ofxCsvColumn<T> &column);
+
+		/// Decompress to a typed column, clears the column's values.
+		void decompress(ofxCsvColumn<T> &column) const;
+
+		/// Add a value to the end.
+		void push(T value);
+
+		/// Add a null to the end.
+		void pushNull();
+
+		/// Clear all values.
+		void clear();
+
+	/// \section Access
+
+		/// Get the value at an index.
+		/// \returns the value or fallback if null or out of range
+		T get(size_t index, T fallback=T()) const;
+
+		/// Is the value at an index null? Out of range values are null.
+		bool isNull(size_t index) const;
+
+		/// Decode a block of values, nulls are T().
+		///
+		/// \param block Block index, the last block may be the partial tail.
+		/// \param out Set to the block's values.
+		/// \returns false if the block doesn't exist
+		bool getBlock(size_t block, vector<T> &out) const;
+
+		/// Get the number of values including nulls.
+		size_t size() const;
+
+		/// Is the column empty?
+		bool empty() const;
+
+		/// Get the number of blocks including the partial tail.
+		size_t getNumBlocks() const;
+
+		/// Get the number of nulls.
+		size_t getNumNulls() const;
+
+		/// Get the approximate memory used by the values & bitmap in bytes.
+		size_t getNumBytes() const;
+
+	protected:
+
+		/// compressed block info
+		struct Block {
+
+			/// block encoding
+			enum Encoding : uint8_t {
+				FRAME_OF_REFERENCE, //< bit packed offsets from the min
+				DELTA,              //< bit packed zigzag deltas
+				XOR                 //< Gorilla style XOR with the previous value
+			};
+
+			size_t offset;      //< first word in the packed data
+			uint64_t reference; //< FRAME_OF_REFERENCE min or DELTA first value
+			Encoding encoding;  //< encoding
+			uint8_t width;      //< packed bits per value
+		};
+
+		/// compress the full tail block
+		void compressTail();
+
+		/// decode a compressed block
+		void decodeBlock(size_t block, T *out) const;
+
+		vector<Block> blocks;      //< compressed blocks
+		vector<uint64_t> words;    //< packed block data
+		vector<T> tail;            //< uncompressed values after the blocks
+		vector<uint64_t> validity; //< validity bitmap, 1 bit per value
+		size_t numNulls;           //< number of nulls
+		T previous;                //< last value, stored for nulls
+
+		mutable vector<T> cache;   //< last decoded block values
+		mutable size_t cacheBlock; //< last decoded block index
+};
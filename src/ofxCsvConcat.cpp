@@ -0,0 +1,252 @@
+/**
+ *  ofxCsvConcat.cpp
+ *  Inspired and based on Ben Fry's [table class](http://benfry.com/writing/map/Table.pde)
+ *
+ *  The MIT License
+ *
+ *  Copyright (c) 2011-2019 Paul Vollmer, https://paulvollmer.net
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ *
+ *  @modified           2026.10.18
+ *  @version            0.2.1
+ */
+
+#include "ofxCsvConcat.h"
+
+#include "ofLog.h"
+#include "ofUtils.h"
+#include "ofFileUtils.h"
+
+#include <cstring>
+
+#ifdef TARGET_LINUX
+	#include <unistd.h>
+	#include <sys/sendfile.h>
+	#include <cerrno>
+#endif
+
+// 64 bit file seeking
+#ifdef TARGET_WIN32
+	#define ofxCsvSeek _fseeki64
+#else
+	#define ofxCsvSeek fseeko
+#endif
+
+/// read/write copy buffer size
+static const size_t s_bufferSize = 1 << 20;
+
+//--------------------------------------------------
+ofxCsvConcat::ofxCsvConcat() {
+	header = true;
+	numBytes = 0;
+	numFiles = 0;
+}
+
+/// SETUP
+
+//--------------------------------------------------
+void ofxCsvConcat::setHeader(bool header) {
+	this->header = header;
+}
+
+/// JOINING
+
+//--------------------------------------------------
+bool ofxCsvConcat::concat(const vector<string> &inputs, const string &output) {
+	numBytes = 0;
+	numFiles = 0;
+
+	// open output
+	string outPath = ofToDataPath(output, true);
+	for(auto &input : inputs) {
+		if(ofToDataPath(input, true) == outPath) {
+			ofLogError("ofxCsvConcat") << "Cannot join to " << output << ": output is an input file";
+			return false;
+		}
+	}
+	string dir = ofFilePath::getEnclosingDirectory(outPath, false);
+	if(!ofDirectory::doesDirectoryExist(dir, false) && !ofDirectory::createDirectory(dir, false, true)) {
+		ofLogError("ofxCsvConcat") << "Cannot join to " << output << ": couldn't create " << dir;
+		return false;
+	}
+	FILE *out = fopen(outPath.c_str(), "wb");
+	if(!out) {
+		ofLogError("ofxCsvConcat") << "Cannot join to " << output << ": file not writable";
+		return false;
+	}
+
+	bool ok = true;
+	bool headerWritten = false;
+	string firstHeader, line;
+	for(auto &input : inputs) {
+		ofFile file(ofToDataPath(input, true), ofFile::Reference);
+		FILE *in = fopen(file.getAbsolutePath().c_str(), "rb");
+		if(!in) {
+			ofLogError("ofxCsvConcat") << "Cannot join " << input << ": file not readable";
+			ok = false;
+			break;
+		}
+		uint64_t size = file.getSize();
+		uint64_t start = 0;
+		if(size == 0) {
+			fclose(in);
+			continue;
+		}
+
+		// check header
+		if(header) {
+			start = readFirstLine(in, line);
+			if(start == 0) {
+				ofLogError("ofxCsvConcat") << "Cannot join " << input << ": couldn't read header";
+				fclose(in);
+				ok = false;
+				break;
+			}
+			if(!headerWritten) {
+				firstHeader = line;
+				line += '\n';
+				ok = fwrite(line.data(), 1, line.size(), out) == line.size();
+				numBytes += line.size();
+				headerWritten = true;
+			}
+			else if(line != firstHeader) {
+				ofLogError("ofxCsvConcat") << "Cannot join " << input << ": header \"" << line
+				                           << "\" doesn't match \"" << firstHeader << "\"";
+				fclose(in);
+				ok = false;
+				break;
+			}
+		}
+
+		// copy the rest & make sure it ends with a newline
+		if(ok && start < size) {
+			ok = copyRange(in, start, size - start, out);
+			numBytes += size - start;
+			char last = '\n';
+			if(ok && ofxCsvSeek(in, size - 1, SEEK_SET) == 0 && fread(&last, 1, 1, in) == 1 && last != '\n') {
+				ok = fputc('\n', out) != EOF;
+				numBytes++;
+			}
+		}
+		fclose(in);
+		if(!ok) {
+			ofLogError("ofxCsvConcat") << "Could not join " << input << ": couldn't copy";
+			break;
+		}
+		numFiles++;
+	}
+	ok = (fclose(out) == 0) && ok;
+	if(!ok) {
+		return false;
+	}
+
+	ofLogVerbose("ofxCsvConcat") << "Joined " << numFiles << " files into " << output
+	                             << " (" << numBytes << " bytes)";
+	return true;
+}
+
+//--------------------------------------------------
+uint64_t ofxCsvConcat::getNumBytes() const {
+	return numBytes;
+}
+
+//--------------------------------------------------
+size_t ofxCsvConcat::getNumFiles() const {
+	return numFiles;
+}
+
+// PROTECTED
+
+//--------------------------------------------------
+uint64_t ofxCsvConcat::readFirstLine(FILE *file, string &line) {
+	line.clear();
+	if(ofxCsvSeek(file, 0, SEEK_SET) != 0) {
+		return 0;
+	}
+	char buffer[4096];
+	uint64_t offset = 0;
+	size_t read;
+	while((read = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+		const char *newline = (const char *)memchr(buffer, '\n', read);
+		if(newline) {
+			line.append(buffer, newline - buffer);
+			offset += (newline - buffer) + 1;
+			break;
+		}
+		line.append(buffer, read);
+		offset += read;
+	}
+	if(!line.empty() && line.back() == '\r') {
+		line.pop_back();
+	}
+	return offset;
+}
+
+//--------------------------------------------------
+bool ofxCsvConcat::copyRange(FILE *in, uint64_t offset, uint64_t size, FILE *out) {
+#ifdef TARGET_LINUX
+	// copy in the kernel, appending at the output file position
+	if(fflush(out) == 0) {
+		int inFd = fileno(in), outFd = fileno(out);
+		bool copyFileRange = true;
+		uint64_t done = 0;
+		while(done < size) {
+			size_t chunk = min<uint64_t>(size - done, 1 << 30);
+			ssize_t copied = -1;
+			if(copyFileRange) {
+				loff_t from = offset + done;
+				copied = copy_file_range(inFd, &from, outFd, nullptr, chunk, 0);
+				if(copied < 0 && (errno == ENOSYS || errno == EXDEV || errno == EINVAL || errno == EOPNOTSUPP)) {
+					copyFileRange = false; // not supported for these files, try sendfile
+					continue;
+				}
+			}
+			else {
+				off_t from = offset + done;
+				copied = sendfile(outFd, inFd, &from, chunk);
+			}
+			if(copied <= 0) {
+				break;
+			}
+			done += copied;
+		}
+		ofxCsvSeek(out, 0, SEEK_END); // resync the stream with the descriptor
+		if(done == size) {
+			return true;
+		}
+		offset += done;
+		size -= done;
+	}
+#endif
+
+	// read & write fallback
+	if(ofxCsvSeek(in, offset, SEEK_SET) != 0) {
+		return false;
+	}
+	vector<char> buffer(min<uint64_t>(size, s_bufferSize));
+	while(size > 0) {
+		size_t read = fread(buffer.data(), 1, min<uint64_t>(size, buffer.size()), in);
+		if(read == 0 || fwrite(buffer.data(), 1, read, out) != read) {
+			return false;
+		}
+		size -= read;
+	}
+	return true;
+}
@@ -0,0 +1,94 @@
+/**
+ *  ofxCsvConcat.h
+ *  Inspired and based on Ben Fry's [table class](http://benfry.com/writing/map/Table.pde)
+ *
+ *  The MIT License
+ *
+ *  Copyright (c) 2011-2019 Paul Vollmer, https://paulvollmer.net
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ *
+ *  @modified           2026.10.18
+ *  @version            0.2.1
+ */
+
+#pragma once
+
+#include "ofConstants.h"
+
+/// \class ofxCsvConcat
+/// \brief joins CSV files with the same header without parsing them
+///
+/// Only the first line of each file is read to check that the headers
+/// match. The rest of each file is copied as is, on Linux with
+/// copy_file_range() or sendfile() so the data stays in the kernel:
+///
+///     ofxCsvConcat concat;
+///     concat.concat({"shards/a.0000.csv", "shards/a.0001.csv"}, "a.csv");
+///
+/// The header is written once at the top of the output. A newline is added
+/// after any file whose last line doesn't end with one.
+///
+class ofxCsvConcat {
+
+	public:
+
+		/// Constructor. Initializes and starts the class.
+		ofxCsvConcat();
+
+	/// \section Setup
+
+		/// Set whether each file starts with a header row which must match
+		/// the first file's header, default true. When false, files are
+		/// joined whole.
+		void setHeader(bool header);
+
+	/// \section Joining
+
+		/// Join CSV files into a single file.
+		///
+		/// Creates any required folders in the output path, if needed. Empty
+		/// files are skipped.
+		///
+		/// \param inputs Input file paths, in order.
+		/// \param output Output file path, must not be one of the inputs.
+		/// \returns true if the files were joined successfully, false if a
+		///          file couldn't be read or has a different header
+		bool concat(const vector<string> &inputs, const string &output);
+
+		/// Get the number of bytes written by the last join.
+		uint64_t getNumBytes() const;
+
+		/// Get the number of files joined by the last join.
+		size_t getNumFiles() const;
+
+	protected:
+
+		/// read the first line of a file, without the line ending
+		/// \returns the offset of the following line, 0 on error
+		static uint64_t readFirstLine(FILE *file, string &line);
+
+		/// copy a byte range from one file to the end of another
+		/// \returns true on success
+		static bool copyRange(FILE *in, uint64_t offset, uint64_t size, FILE *out);
+
+		bool header;       //< check & skip headers?
+		uint64_t numBytes; //< bytes written by the last join
+		size_t numFiles;   //< files joined by the last join
+};
@@ -0,0 +1,490 @@
+/**
+ *  ofxCsvDiff.cpp
+ *  Inspired and based on Ben Fry's [table class](http://benfry.com/writing/map/Table.pde)
+ *
+ *  The MIT License
+ *
+ *  Copyright (c) 2011-2019 Paul Vollmer, https://paulvollmer.net
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ *
+ *  @modified           2026.10.18
+ *  @version            0.2.1
+ */
+
+#include "ofxCsvDiff.h"
+
+#include "ofxCsvReader.h"
+#include "ofLog.h"
+#include "ofUtils.h"
+#include "ofFileUtils.h"
+
+#include <algorithm>
+#include <cstring>
+#include <thread>
+
+/// file read block size, grows to fit long lines
+static const size_t s_bufferSize = 8 << 20;
+
+/// min number of lines to hash per thread
+static const size_t s_minThreadLines = 4096;
+
+/// FNV-1a hash of a byte range
+static inline uint64_t hashBytes(const char *data, size_t size) {
+	uint64_t hash = 14695981039346656037ULL;
+	for(size_t i = 0; i < size; i++) {
+		hash = (hash ^ (unsigned char)data[i]) * 1099511628211ULL;
+	}
+	return hash;
+}
+
+/// splitmix64 finalizer, spreads a hash's bits when combining
+static inline uint64_t mix(uint64_t h) {
+	h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	h = (h ^ (h >> 27)) * 0x94d049bb133111ebULL;
+	return h ^ (h >> 31);
+}
+
+/// find a key's slot in an open addressing table by linear probing, the
+/// first empty slot if the key isn't in the table
+template<typename Entry>
+static inline size_t findSlot(const vector<Entry> &table, uint64_t key) {
+	size_t mask = table.size() - 1;
+	size_t slot = mix(key) & mask;
+	while(table[slot].key != 0 && table[slot].key != key) {
+		slot = (slot + 1) & mask;
+	}
+	return slot;
+}
+
+/// CHANGE
+
+//--------------------------------------------------
+string ofxCsvDiff::Change::toString() const {
+	switch(type) {
+		case ADDED:
+			return "added: row " + std::to_string(newRow);
+		case REMOVED:
+			return "removed: row " + std::to_string(oldRow);
+		case MODIFIED:
+			return "modified: row " + std::to_string(oldRow) + " -> " + std::to_string(newRow);
+	}
+	return "";
+}
+
+//--------------------------------------------------
+ostream& operator<<(ostream &ostr, const ofxCsvDiff::Change &change) {
+	ostr << change.toString();
+	return ostr;
+}
+
+/// DIFF
+
+//--------------------------------------------------
+ofxCsvDiff::ofxCsvDiff() {
+	header = true;
+	ignoreOrder = false;
+	ignoreWhitespace = false;
+	threads = 0;
+	numAdded = 0;
+	numRemoved = 0;
+	numModified = 0;
+}
+
+/// SETUP
+
+//--------------------------------------------------
+void ofxCsvDiff::setKeyCols(const vector<int> &cols) {
+	keyCols.clear();
+	for(int col : cols) {
+		keyCols.push_back(max(col, 0));
+	}
+}
+
+//--------------------------------------------------
+void ofxCsvDiff::setHeader(bool header) {
+	this->header = header;
+}
+
+//--------------------------------------------------
+void ofxCsvDiff::setIgnoreColumnOrder(bool ignore) {
+	ignoreOrder = ignore;
+}
+
+//--------------------------------------------------
+void ofxCsvDiff::setIgnoreWhitespace(bool ignore) {
+	ignoreWhitespace = ignore;
+}
+
+//--------------------------------------------------
+void ofxCsvDiff::setThreads(unsigned int threads) {
+	this->threads = threads;
+}
+
+/// COMPARING
+
+//--------------------------------------------------
+bool ofxCsvDiff::compare(const string &oldPath, const string &newPath,
+                         const string &separator, const string &comment) {
+	changes.clear();
+	numAdded = numRemoved = numModified = 0;
+	tokenizer.setSeparator(separator);
+	commentPrefix = comment;
+
+	// match new cols to old cols by name: old cols first, then new only cols
+	vector<int> oldCols, newCols;
+	if(ignoreOrder && header) {
+		vector<string> oldNames, newNames;
+		if(!readHeader(oldPath, oldNames) || !readHeader(newPath, newNames)) {
+			return false;
+		}
+		vector<bool> used(newNames.size(), false);
+		for(size_t i = 0; i < oldNames.size(); i++) {
+			oldCols.push_back(i);
+			int found = -1;
+			for(size_t j = 0; j < newNames.size(); j++) {
+				if(!used[j] && newNames[j] == oldNames[i]) {
+					found = j;
+					used[j] = true;
+					break;
+				}
+			}
+			newCols.push_back(found);
+		}
+		for(size_t j = 0; j < newNames.size(); j++) {
+			if(!used[j]) {
+				oldCols.push_back(-1);
+				newCols.push_back(j);
+			}
+		}
+	}
+
+	// collapse both files into one table of distinct keys
+	vector<KeyRows> table(1024, KeyRows{0, 0, 0});
+	size_t used = 0, oldRows = 0, newRows = 0;
+	if(!collapseFile(oldPath, oldCols, false, table, used, oldRows) ||
+	   !collapseFile(newPath, newCols, true, table, used, newRows)) {
+		return false;
+	}
+
+	// keys whose rows differ: missing from either file, a different number
+	// of rows, or different rows in order
+	vector<uint64_t> changedKeys;
+	for(const KeyRows &entry : table) {
+		if(entry.key != 0 && entry.oldRows != entry.newRows) {
+			changedKeys.push_back(entry.key);
+		}
+	}
+	vector<KeyRows>().swap(table);
+	if(changedKeys.empty()) {
+		ofLogVerbose("ofxCsvDiff") << "Compared " << oldRows << " with " << newRows << " rows: equal";
+		return true;
+	}
+	std::sort(changedKeys.begin(), changedKeys.end());
+
+	// read again for the positions of the changed keys' rows only
+	vector<RowHash> oldHashes, newHashes;
+	auto collect = [&](vector<RowHash> &out) {
+		return [&changedKeys, &out](const vector<RowHash> &hashes) {
+			for(const RowHash &hash : hashes) {
+				if(std::binary_search(changedKeys.begin(), changedKeys.end(), hash.key)) {
+					out.push_back(hash);
+				}
+			}
+		};
+	};
+	if(!hashFile(oldPath, oldCols, collect(oldHashes)) || !hashFile(newPath, newCols, collect(newHashes))) {
+		return false;
+	}
+
+	// sort by key & walk both, rows with equal keys are matched in order
+	auto byKey = [](const RowHash &a, const RowHash &b) {
+		return a.key < b.key || (a.key == b.key && a.index < b.index);
+	};
+	std::sort(oldHashes.begin(), oldHashes.end(), byKey);
+	std::sort(newHashes.begin(), newHashes.end(), byKey);
+	size_t i = 0, j = 0;
+	while(i < oldHashes.size() || j < newHashes.size()) {
+		if(j == newHashes.size() || (i < oldHashes.size() && oldHashes[i].key < newHashes[j].key)) {
+			changes.push_back({Change::REMOVED, oldHashes[i++].index, Change::npos});
+			numRemoved++;
+		}
+		else if(i == oldHashes.size() || newHashes[j].key < oldHashes[i].key) {
+			changes.push_back({Change::ADDED, Change::npos, newHashes[j++].index});
+			numAdded++;
+		}
+		else {
+			if(oldHashes[i].row != newHashes[j].row) {
+				changes.push_back({Change::MODIFIED, oldHashes[i].index, newHashes[j].index});
+				numModified++;
+			}
+			i++;
+			j++;
+		}
+	}
+
+	// order by position in the new file, removed rows by their old position
+	std::stable_sort(changes.begin(), changes.end(), [](const Change &a, const Change &b) {
+		size_t pa = (a.type == Change::REMOVED ? a.oldRow : a.newRow);
+		size_t pb = (b.type == Change::REMOVED ? b.oldRow : b.newRow);
+		return pa < pb || (pa == pb && a.type == Change::REMOVED && b.type != Change::REMOVED);
+	});
+
+	ofLogVerbose("ofxCsvDiff") << "Compared " << oldRows << " with " << newRows
+	                           << " rows: " << numAdded << " added, " << numRemoved << " removed, "
+	                           << numModified << " modified";
+	return true;
+}
+
+//--------------------------------------------------
+const vector<ofxCsvDiff::Change>& ofxCsvDiff::getChanges() const {
+	return changes;
+}
+
+//--------------------------------------------------
+bool ofxCsvDiff::isEqual() const {
+	return changes.empty();
+}
+
+//--------------------------------------------------
+size_t ofxCsvDiff::getNumAdded() const {
+	return numAdded;
+}
+
+//--------------------------------------------------
+size_t ofxCsvDiff::getNumRemoved() const {
+	return numRemoved;
+}
+
+//--------------------------------------------------
+size_t ofxCsvDiff::getNumModified() const {
+	return numModified;
+}
+
+// PROTECTED
+
+//--------------------------------------------------
+bool ofxCsvDiff::readHeader(const string &path, vector<string> &fields) {
+	ofxCsvReader reader;
+	if(!reader.open(path, tokenizer.getSeparator(), commentPrefix)) {
+		return false;
+	}
+	fields.clear();
+	if(reader.next()) {
+		fields = reader.getRow().toRow().getData();
+		if(ignoreWhitespace) {
+			for(auto &field : fields) {
+				field.erase(0, field.find_first_not_of(" \t"));
+				field.erase(field.find_last_not_of(" \t") + 1);
+			}
+		}
+	}
+	return true;
+}
+
+//--------------------------------------------------
+bool ofxCsvDiff::hashFile(const string &path, const vector<int> &cols, const HashConsumer &consume) {
+
+	// do some checks
+	ofFile info(ofToDataPath(path), ofFile::Reference);
+	if(!info.exists()) {
+		ofLogError("ofxCsvDiff") << "Cannot compare " << path << ": file not found";
+		return false;
+	}
+	if(info.isDirectory()) {
+		ofLogError("ofxCsvDiff") << "Cannot compare " << path << ": \"file\" is actually a directory";
+		return false;
+	}
+	FILE *file = fopen(info.getAbsolutePath().c_str(), "rb");
+	if(!file) {
+		ofLogError("ofxCsvDiff") << "Cannot compare " << path << ": file not readable";
+		return false;
+	}
+
+	size_t numThreads = threads > 0 ? threads : max(std::thread::hardware_concurrency(), 1u);
+	vector<char> buffer(s_bufferSize);
+	vector<std::pair<const char*, size_t>> lines;
+	vector<RowHash> hashes;
+	size_t numLines = 0;
+	size_t filled = 0;
+	bool eof = false;
+	bool skipHeader = header;
+	while(true) {
+		if(!eof) {
+			size_t read = fread(buffer.data() + filled, 1, buffer.size() - filled, file);
+			filled += read;
+			eof = (read == 0);
+		}
+
+		// collect the complete lines in the buffer
+		lines.clear();
+		const char *begin = buffer.data();
+		const char *end = begin + filled;
+		const char *start = begin;
+		while(start < end) {
+			const char *newline = (const char *)memchr(start, '\n', end - start);
+			if(!newline && !eof) {
+				break; // incomplete line, read more
+			}
+			const char *lineEnd = newline ? newline : end;
+			if(lineEnd > start && *(lineEnd-1) == '\r') {
+				lineEnd--;
+			}
+			size_t size = lineEnd - start;
+			bool isComment = !commentPrefix.empty() && size >= commentPrefix.size() &&
+			                 memcmp(start, commentPrefix.data(), commentPrefix.size()) == 0;
+			if(size > 0 && !isComment) {
+				if(skipHeader) {
+					skipHeader = false;
+				}
+				else {
+					lines.push_back(std::make_pair(start, size));
+				}
+			}
+			start = newline ? newline + 1 : end;
+		}
+
+		// hash the lines in parallel slices
+		size_t first = numLines;
+		hashes.resize(lines.size());
+		size_t sliceThreads = max<size_t>(min(numThreads, lines.size() / s_minThreadLines), 1);
+		auto hashSlice = [&](size_t t) {
+			vector<ofxCsvFieldView> fields;
+			string scratch;
+			size_t from = lines.size() * t / sliceThreads;
+			size_t to = lines.size() * (t + 1) / sliceThreads;
+			for(size_t l = from; l < to; l++) {
+				RowHash &hash = hashes[l];
+				hash.index = first + l;
+				hashLine(lines[l].first, lines[l].second, cols, fields, scratch, hash);
+			}
+		};
+		vector<std::thread> workers;
+		for(size_t t = 1; t < sliceThreads; t++) {
+			workers.emplace_back(hashSlice, t);
+		}
+		hashSlice(0);
+		for(auto &worker : workers) {
+			worker.join();
+		}
+		numLines += lines.size();
+		consume(hashes);
+
+		// keep any partial line for the next read
+		size_t consumed = start - begin;
+		memmove(buffer.data(), buffer.data() + consumed, filled - consumed);
+		filled -= consumed;
+		if(eof && filled == 0) {
+			break;
+		}
+		if(filled == buffer.size()) {
+			buffer.resize(buffer.size() * 2);
+		}
+	}
+	bool error = ferror(file) != 0;
+	fclose(file);
+	if(error) {
+		ofLogError("ofxCsvDiff") << "Cannot compare " << path << ": couldn't read";
+		return false;
+	}
+	return true;
+}
+
+//--------------------------------------------------
+bool ofxCsvDiff::collapseFile(const string &path, const vector<int> &cols, bool isNew,
+                              vector<KeyRows> &table, size_t &used, size_t &rows) {
+	rows = 0;
+	return hashFile(path, cols, [&](const vector<RowHash> &hashes) {
+		for(const RowHash &hash : hashes) {
+			// grow at 3/4 full, reinserting the distinct keys
+			if((used + 1) * 4 > table.size() * 3) {
+				vector<KeyRows> grown(table.size() * 2, KeyRows{0, 0, 0});
+				for(const KeyRows &entry : table) {
+					if(entry.key != 0) {
+						grown[findSlot(grown, entry.key)] = entry;
+					}
+				}
+				table.swap(grown);
+			}
+			KeyRows &entry = table[findSlot(table, hash.key)];
+			if(entry.key == 0) {
+				entry.key = hash.key;
+				used++;
+			}
+			// order dependent & includes the number of rows, so rows with the
+			// same key are compared in order
+			uint64_t &keyRows = isNew ? entry.newRows : entry.oldRows;
+			keyRows = mix(keyRows + hash.row);
+		}
+		rows += hashes.size();
+	});
+}
+
+//--------------------------------------------------
+void ofxCsvDiff::hashLine(const char *line, size_t size, const vector<int> &cols,
+                          vector<ofxCsvFieldView> &fields, string &scratch, RowHash &hash) const {
+	tokenizer.split(line, size, fields);
+	bool unordered = ignoreOrder && cols.empty();
+	size_t numCols = cols.empty() ? fields.size() : cols.size();
+	const uint64_t emptyHash = hashBytes("", 0);
+
+	// hash a col in compared order, missing cols hash like empty fields
+	auto hashCol = [&](size_t col) {
+		int index = cols.empty() ? (int)col : (col < cols.size() ? cols[col] : -1);
+		if(index < 0 || (size_t)index >= fields.size()) {
+			return emptyHash;
+		}
+		const ofxCsvFieldView &field = fields[index];
+		const char *data = field.data;
+		size_t length = field.size;
+		if(field.quoted) {
+			field.str(scratch);
+			data = scratch.data();
+			length = scratch.size();
+		}
+		if(ignoreWhitespace) {
+			while(length > 0 && (*data == ' ' || *data == '\t')) {
+				data++;
+				length--;
+			}
+			while(length > 0 && (data[length-1] == ' ' || data[length-1] == '\t')) {
+				length--;
+			}
+		}
+		return hashBytes(data, length);
+	};
+
+	hash.row = numCols;
+	for(size_t col = 0; col < numCols; col++) {
+		uint64_t h = hashCol(col);
+		hash.row = unordered ? hash.row + mix(h) : mix(hash.row + h);
+	}
+	if(keyCols.empty()) {
+		hash.key = hash.row;
+	}
+	else {
+		hash.key = keyCols.size();
+		for(int col : keyCols) {
+			hash.key = mix(hash.key + hashCol(col));
+		}
+	}
+	if(hash.key == 0) {
+		hash.key = 1; // 0 marks empty key table slots
+	}
+}
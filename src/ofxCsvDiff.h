@@ -0,0 +1,203 @@
+/**
+ *  ofxCsvDiff.h
+ *  Inspired and based on Ben Fry's [table class](http://benfry.com/writing/map/Table.pde)
+ *
+ *  The MIT License
+ *
+ *  Copyright (c) 2011-2019 Paul Vollmer, https://paulvollmer.net
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ *
+ *  @modified           2026.10.18
+ *  @version            0.2.1
+ */
+
+#pragma once
+
+#include "ofxCsvTokenizer.h"
+
+#include <functional>
+
+/// \class ofxCsvDiff
+/// \brief finds added, removed, & modified rows between two CSV files
+///
+/// Rows are reduced to 64 bit hashes on several threads while the files are
+/// read & collapsed into one table of distinct keys, ie. distinct rows
+/// without key cols, so memory use depends on the number of distinct keys
+/// & not the file size:
+///
+///     ofxCsvDiff diff;
+///     diff.setKeyCols({0}); // match rows by id
+///     diff.compare("export-monday.csv", "export-tuesday.csv");
+///     for(auto &change : diff.getChanges()) {
+///         ofLog() << change;
+///     }
+///
+/// Without key cols, whole rows are compared & rows are only ever added or
+/// removed. With key cols, rows with the same key but different fields are
+/// reported as modified. Rows are matched in order when a row or key occurs
+/// more than once.
+///
+/// Row positions are only needed for changes: if any keys differ, both files
+/// are read a second time & only the rows of the changed keys are kept.
+/// Identical files are read once.
+///
+/// As only hashes are compared, a hash collision could hide a change, which
+/// is very unlikely with 64 bit hashes.
+///
+class ofxCsvDiff {
+
+	public:
+
+		/// a changed row
+		struct Change {
+
+			/// change type
+			enum Type {
+				ADDED,   //< row only in the new file
+				REMOVED, //< row only in the old file
+				MODIFIED //< row key in both files but with different fields
+			};
+
+			Type type;     //< change type
+			size_t oldRow; //< old file row index, npos if added
+			size_t newRow; //< new file row index, npos if removed
+
+			/// not a row index
+			static const size_t npos = (size_t)-1;
+
+			/// Get the change as a readable string, ie. "modified: row 10 -> 12"
+			string toString() const;
+
+			/// Streams the change as a readable string.
+			friend ostream& operator<<(ostream &ostr, const Change &change);
+		};
+
+		/// Constructor. Initializes and starts the class.
+		ofxCsvDiff();
+
+	/// \section Setup
+
+		/// Set the key cols used to match rows between the files, empty to
+		/// compare whole rows, default empty.
+		void setKeyCols(const vector<int> &cols);
+
+		/// Set whether the first row is a header which is skipped, default
+		/// true. Row indices don't include the header.
+		void setHeader(bool header);
+
+		/// Set whether to ignore col order, default false.
+		///
+		/// With a header, new file cols are matched to old file cols by name
+		/// & key cols refer to the old file. Without a header, fields are
+		/// compared as an unordered set.
+		void setIgnoreColumnOrder(bool ignore);
+
+		/// Set whether to ignore leading & trailing whitespace in fields,
+		/// default false.
+		void setIgnoreWhitespace(bool ignore);
+
+		/// Set the number of hashing threads, default 0 to use the number
+		/// of hardware threads.
+		void setThreads(unsigned int threads);
+
+	/// \section Comparing
+
+		/// Compare two CSV files.
+		///
+		/// Skips empty lines & lines beginning with the comment prefix.
+		///
+		/// \param oldPath Old file path.
+		/// \param newPath New file path.
+		/// \param separator Field separator string, default comma ",".
+		/// \param comment Comment line prefix string, default "#".
+		/// \returns true if both files were read successfully
+		bool compare(const string &oldPath, const string &newPath,
+		             const string &separator=",", const string &comment="#");
+
+		/// Get the changes from the last comparison, ordered by row.
+		const vector<Change>& getChanges() const;
+
+		/// Are the files the same? Only valid after a comparison.
+		bool isEqual() const;
+
+		/// Get the number of added rows from the last comparison.
+		size_t getNumAdded() const;
+
+		/// Get the number of removed rows from the last comparison.
+		size_t getNumRemoved() const;
+
+		/// Get the number of modified rows from the last comparison.
+		size_t getNumModified() const;
+
+	protected:
+
+		/// row hashes
+		struct RowHash {
+			uint64_t key; //< key cols hash, same as row without key cols
+			uint64_t row; //< whole row hash
+			size_t index; //< row index
+		};
+
+		/// a distinct key in either file
+		struct KeyRows {
+			uint64_t key;     //< key cols hash, 0 for an empty slot
+			uint64_t oldRows; //< hash of the key's old file row hashes in order, 0 if none
+			uint64_t newRows; //< hash of the key's new file row hashes in order, 0 if none
+		};
+
+		/// called with each block of row hashes in file order
+		typedef std::function<void(const vector<RowHash> &hashes)> HashConsumer;
+
+		/// read a file's header fields
+		bool readHeader(const string &path, vector<string> &fields);
+
+		/// read & hash a file's rows a block at a time
+		///
+		/// \param cols File col for each compared col, -1 for a missing col,
+		///             empty for the file's own order.
+		/// \param consume Called with each block's hashes.
+		bool hashFile(const string &path, const vector<int> &cols, const HashConsumer &consume);
+
+		/// collapse a file's rows into an open addressing table of distinct
+		/// keys, a power of 2 in size & shared by both files
+		///
+		/// \param isNew Is this the new file?
+		/// \param used Number of used slots, updated.
+		/// \param rows Set to the number of rows read.
+		bool collapseFile(const string &path, const vector<int> &cols, bool isNew,
+		                  vector<KeyRows> &table, size_t &used, size_t &rows);
+
+		/// hash a line
+		void hashLine(const char *line, size_t size, const vector<int> &cols,
+		              vector<ofxCsvFieldView> &fields, string &scratch, RowHash &hash) const;
+
+		vector<int> keyCols;     //< key cols, empty for whole rows
+		bool header;             //< skip the first row as a header?
+		bool ignoreOrder;        //< ignore col order?
+		bool ignoreWhitespace;   //< ignore leading & trailing field whitespace?
+		unsigned int threads;    //< hashing threads, 0 for hardware threads
+
+		ofxCsvTokenizer tokenizer; //< field tokenizer
+		string commentPrefix;    //< comment line prefix
+		vector<Change> changes;  //< changes from the last comparison
+		size_t numAdded;         //< number of added rows
+		size_t numRemoved;       //< number of removed rows
+		size_t numModified;      //< number of modified rows
+};
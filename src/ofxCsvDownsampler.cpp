@@ -0,0 +1,339 @@
+/**
+ *  ofxCsvDownsampler.cpp
+ *  Inspired and based on Ben Fry's [table class](http://benfry.com/writing/map/Table.pde)
+ *
+ *  The MIT License
+ *
+ *  Copyright (c) 2011-2019 Paul Vollmer, https://paulvollmer.net
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ *
+ *  @modified           2026.10.18
+ *  @version            0.2.1
+ */
+
+#include "ofxCsvDownsampler.h"
+#include "ofxCsvParse.h"
+
+#include "ofLog.h"
+#include "ofUtils.h"
+#include "ofPolyline.h"
+
+/// number of points per bucket in the finest pyramid level
+static const size_t s_baseBucketSize = 8;
+
+//--------------------------------------------------
+ofxCsvDownsampler::ofxCsvDownsampler() {}
+
+/// LOADING
+
+//--------------------------------------------------
+bool ofxCsvDownsampler::load(const ofxCsv &csv, int xCol, int yCol, int firstRow) {
+	vector<double> x;
+	vector<float> y;
+	size_t minCols = max(xCol, yCol) + 1;
+	ofxCsvNumberFormat format = csv.getNumberFormat();
+	size_t index = 0;
+	for(auto &row : csv) {
+		if(index >= (size_t)max(firstRow, 0) && row.size() >= minCols) {
+			double xValue = (double)index;
+			if(xCol >= 0) {
+				const string &field = *(row.begin() + xCol);
+				xValue = 0;
+				ofxCsvParse::toDouble(field.data(), field.data() + field.size(), xValue, format);
+			}
+			x.push_back(xValue);
+			y.push_back(row.getFloat(yCol, format));
+		}
+		index++;
+	}
+	return load(x, y);
+}
+
+//--------------------------------------------------
+bool ofxCsvDownsampler::load(const vector<double> &x, const vector<float> &y) {
+	clear();
+	if(x.size() != y.size()) {
+		ofLogError("ofxCsvDownsampler") << "Cannot load series: "
+			<< x.size() << " x values for " << y.size() << " y values";
+		return false;
+	}
+	if(x.empty()) {
+		ofLogWarning("ofxCsvDownsampler") << "Nothing to load";
+		return false;
+	}
+	for(size_t i = 1; i < x.size(); i++) {
+		if(x[i] < x[i-1]) {
+			ofLogError("ofxCsvDownsampler") << "Cannot load series: x values not ascending at " << i;
+			return false;
+		}
+	}
+	xs = x;
+	ys = y;
+	buildPyramid();
+	ofLogVerbose("ofxCsvDownsampler") << "Loaded " << xs.size() << " points into "
+		<< pyramid.size() << " levels";
+	return true;
+}
+
+//--------------------------------------------------
+void ofxCsvDownsampler::clear() {
+	xs.clear();
+	ys.clear();
+	pyramid.clear();
+}
+
+/// DOWNSAMPLING
+
+//--------------------------------------------------
+vector<size_t> ofxCsvDownsampler::getMinMax(double minX, double maxX, int pixels) const {
+	vector<size_t> points;
+	size_t first, last;
+	getRange(minX, maxX, first, last);
+	size_t count = last - first;
+	pixels = max(pixels, 1);
+
+	// few enough points to draw them all
+	if(count <= (size_t)pixels * 2 || pyramid.empty()) {
+		points.resize(count);
+		for(size_t i = 0; i < count; i++) {
+			points[i] = first + i;
+		}
+		return points;
+	}
+
+	// finest level with about one bucket per pixel
+	size_t target = count / pixels;
+	const Level *level = &pyramid.back();
+	for(auto &l : pyramid) {
+		if(l.bucketSize >= target) {
+			level = &l;
+			break;
+		}
+	}
+	size_t firstBucket = first / level->bucketSize;
+	size_t lastBucket = (last-1) / level->bucketSize;
+	points.reserve((lastBucket - firstBucket + 1) * 2);
+	for(size_t b = firstBucket; b <= lastBucket; b++) {
+		size_t lo = min(level->min[b], level->max[b]);
+		size_t hi = max(level->min[b], level->max[b]);
+		points.push_back(lo);
+		if(hi != lo) {
+			points.push_back(hi);
+		}
+	}
+	return points;
+}
+
+//--------------------------------------------------
+vector<size_t> ofxCsvDownsampler::getLttb(double minX, double maxX, int threshold) const {
+	threshold = max(threshold, 3);
+	vector<size_t> candidates = getMinMax(minX, maxX, threshold * 2);
+	return lttb(xs, ys, candidates, threshold);
+}
+
+//--------------------------------------------------
+void ofxCsvDownsampler::getPolyline(const vector<size_t> &indices, ofPolyline &line) const {
+	line.clear();
+	for(auto i : indices) {
+		if(i < xs.size()) {
+			line.addVertex(xs[i], ys[i]);
+		}
+	}
+}
+
+//--------------------------------------------------
+vector<size_t> ofxCsvDownsampler::minMax(const vector<float> &y, size_t buckets) {
+	vector<size_t> points;
+	if(y.empty()) {
+		return points;
+	}
+	buckets = max(min(buckets, y.size()), (size_t)1);
+	points.reserve(buckets * 2);
+	for(size_t b = 0; b < buckets; b++) {
+		size_t start = b * y.size() / buckets;
+		size_t end = (b+1) * y.size() / buckets;
+		size_t lo = start, hi = start;
+		for(size_t i = start+1; i < end; i++) {
+			if(y[i] < y[lo]) {lo = i;}
+			if(y[i] > y[hi]) {hi = i;}
+		}
+		points.push_back(min(lo, hi));
+		if(hi != lo) {
+			points.push_back(max(lo, hi));
+		}
+	}
+	return points;
+}
+
+//--------------------------------------------------
+vector<size_t> ofxCsvDownsampler::lttb(const vector<double> &x, const vector<float> &y, size_t threshold) {
+	vector<size_t> points(min(x.size(), y.size()));
+	for(size_t i = 0; i < points.size(); i++) {
+		points[i] = i;
+	}
+	return lttb(x, y, points, threshold);
+}
+
+/// UTIL
+
+//--------------------------------------------------
+size_t ofxCsvDownsampler::size() const {
+	return xs.size();
+}
+
+//--------------------------------------------------
+bool ofxCsvDownsampler::empty() const {
+	return xs.empty();
+}
+
+//--------------------------------------------------
+double ofxCsvDownsampler::getX(size_t index) const {
+	if(index >= xs.size()) {
+		return 0;
+	}
+	return xs[index];
+}
+
+//--------------------------------------------------
+float ofxCsvDownsampler::getY(size_t index) const {
+	if(index >= ys.size()) {
+		return 0;
+	}
+	return ys[index];
+}
+
+//--------------------------------------------------
+size_t ofxCsvDownsampler::getNumLevels() const {
+	return pyramid.size();
+}
+
+// PROTECTED
+
+//--------------------------------------------------
+void ofxCsvDownsampler::buildPyramid() {
+	pyramid.clear();
+	if(ys.size() <= s_baseBucketSize) {
+		return;
+	}
+
+	// level 0 from the raw points
+	Level base;
+	base.bucketSize = s_baseBucketSize;
+	size_t buckets = (ys.size() + s_baseBucketSize - 1) / s_baseBucketSize;
+	base.min.resize(buckets);
+	base.max.resize(buckets);
+	for(size_t b = 0; b < buckets; b++) {
+		size_t start = b * s_baseBucketSize;
+		size_t end = min(start + s_baseBucketSize, ys.size());
+		size_t lo = start, hi = start;
+		for(size_t i = start+1; i < end; i++) {
+			if(ys[i] < ys[lo]) {lo = i;}
+			if(ys[i] > ys[hi]) {hi = i;}
+		}
+		base.min[b] = lo;
+		base.max[b] = hi;
+	}
+	pyramid.push_back(base);
+
+	// merge pairs of buckets until a single bucket remains
+	while(pyramid.back().min.size() > 1) {
+		const Level &below = pyramid.back();
+		Level level;
+		level.bucketSize = below.bucketSize * 2;
+		buckets = (below.min.size() + 1) / 2;
+		level.min.resize(buckets);
+		level.max.resize(buckets);
+		for(size_t b = 0; b < buckets; b++) {
+			size_t l = b*2, r = min(b*2+1, below.min.size()-1);
+			level.min[b] = ys[below.min[r]] < ys[below.min[l]] ? below.min[r] : below.min[l];
+			level.max[b] = ys[below.max[r]] > ys[below.max[l]] ? below.max[r] : below.max[l];
+		}
+		pyramid.push_back(level);
+	}
+}
+
+//--------------------------------------------------
+void ofxCsvDownsampler::getRange(double minX, double maxX, size_t &first, size_t &last) const {
+	if(minX > maxX) {
+		std::swap(minX, maxX);
+	}
+	first = std::lower_bound(xs.begin(), xs.end(), minX) - xs.begin();
+	last = std::upper_bound(xs.begin(), xs.end(), maxX) - xs.begin();
+	if(first > 0) {
+		first--;
+	}
+	if(last < xs.size()) {
+		last++;
+	}
+}
+
+//--------------------------------------------------
+vector<size_t> ofxCsvDownsampler::lttb(const vector<double> &x, const vector<float> &y,
+                                       const vector<size_t> &points, size_t threshold) {
+	size_t n = points.size();
+	if(threshold < 3 || threshold >= n) {
+		return points;
+	}
+	vector<size_t> sampled;
+	sampled.reserve(threshold);
+
+	// always keep the first point
+	size_t a = 0;
+	sampled.push_back(points[a]);
+
+	// bucket the points between the first & last
+	double every = (double)(n - 2) / (threshold - 2);
+	for(size_t i = 0; i < threshold - 2; i++) {
+
+		// average of the next bucket
+		size_t avgStart = (size_t)((i+1) * every) + 1;
+		size_t avgEnd = min((size_t)((i+2) * every) + 1, n);
+		double avgX = 0, avgY = 0;
+		for(size_t j = avgStart; j < avgEnd; j++) {
+			avgX += x[points[j]];
+			avgY += y[points[j]];
+		}
+		size_t avgCount = max(avgEnd - avgStart, (size_t)1);
+		avgX /= avgCount;
+		avgY /= avgCount;
+
+		// point in this bucket forming the largest triangle with the last
+		// chosen point & the next bucket's average
+		size_t start = (size_t)(i * every) + 1;
+		size_t end = (size_t)((i+1) * every) + 1;
+		double ax = x[points[a]], ay = y[points[a]];
+		double maxArea = -1;
+		size_t next = start;
+		for(size_t j = start; j < end; j++) {
+			double area = fabs((ax - avgX) * (y[points[j]] - ay) -
+			                   (ax - x[points[j]]) * (avgY - ay));
+			if(area > maxArea) {
+				maxArea = area;
+				next = j;
+			}
+		}
+		sampled.push_back(points[next]);
+		a = next;
+	}
+
+	// always keep the last point
+	sampled.push_back(points[n-1]);
+	return sampled;
+}
@@ -0,0 +1,177 @@
+/**
+ *  ofxCsvDownsampler.h
+ *  Inspired and based on Ben Fry's [table class](http://benfry.com/writing/map/Table.pde)
+ *
+ *  The MIT License
+ *
+ *  Copyright (c) 2011-2019 Paul Vollmer, https://paulvollmer.net
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ *
+ *  @modified           2026.10.18
+ *  @version            0.2.1
+ */
+
+#pragma once
+
+#include "ofxCsv.h"
+
+class ofPolyline;
+
+/// \class ofxCsvDownsampler
+/// \brief level of detail downsampling of a numeric x/y series for plotting
+///
+/// Loads an x & y col from an ofxCsv once & precomputes a min/max pyramid so
+/// drawing a zoomed or panned view only touches O(pixels) points:
+///
+///     ofxCsvDownsampler series;
+///     series.load(csv, 0, 1, 1); // time & value cols, skip header row
+///     ...
+///     ofPolyline line;
+///     series.getPolyline(series.getMinMax(viewMinX, viewMaxX, ofGetWidth()), line);
+///
+/// Notes:
+///   * x values must be ascending, use xCol = -1 to plot against row index.
+///   * Pyramid level 0 holds the min & max y index of every 8 points, each
+///     following level merges pairs of buckets from the level below.
+///   * Views include the whole buckets at their edges, so lines run up to
+///     & slightly beyond the view bounds.
+///
+class ofxCsvDownsampler {
+
+	public:
+
+		/// Constructor. Initializes and starts the class.
+		ofxCsvDownsampler();
+
+	/// \section Loading
+
+		/// Load a series from x & y cols & build the pyramid.
+		///
+		/// Clears any currently loaded data. Rows without the required
+		/// cols are skipped.
+		///
+		/// \param csv Table to load from.
+		/// \param xCol X col, must be ascending. Use -1 for the row index.
+		/// \param yCol Y col.
+		/// \param firstRow First row to load, ie. 1 to skip a header row.
+		/// \returns true if any points were loaded
+		bool load(const ofxCsv &csv, int xCol, int yCol, int firstRow=0);
+
+		/// Load a series from x & y values & build the pyramid.
+		///
+		/// Clears any currently loaded data.
+		///
+		/// \param x X values, must be ascending & the same size as y.
+		/// \param y Y values.
+		/// \returns true if any points were loaded
+		bool load(const vector<double> &x, const vector<float> &y);
+
+		/// Clear the current series & pyramid.
+		void clear();
+
+	/// \section Downsampling
+
+		/// Get the min & max points per bucket for a view using the pyramid.
+		///
+		/// Returns all points in the view when there are fewer than 2 per
+		/// pixel.
+		///
+		/// \param minX View start x.
+		/// \param maxX View end x.
+		/// \param pixels View width in pixels, ie. the number of buckets.
+		/// \returns ascending point indices
+		vector<size_t> getMinMax(double minX, double maxX, int pixels) const;
+
+		/// Get the Largest Triangle Three Buckets points for a view.
+		///
+		/// Runs LTTB over the min/max candidates from the pyramid so the cost
+		/// depends on the threshold, not the number of points in the view.
+		///
+		/// \param minX View start x.
+		/// \param maxX View end x.
+		/// \param threshold Desired number of output points, minimum of 3.
+		/// \returns ascending point indices
+		vector<size_t> getLttb(double minX, double maxX, int threshold) const;
+
+		/// Fill a polyline with the given points, replacing its vertices.
+		///
+		/// \param indices Point indices, ie. from getMinMax() or getLttb().
+		/// \param line Polyline to fill.
+		void getPolyline(const vector<size_t> &indices, ofPolyline &line) const;
+
+		/// Min/max downsample a whole y series into equal buckets.
+		///
+		/// \param y Y values.
+		/// \param buckets Number of buckets.
+		/// \returns ascending point indices, up to 2 per bucket
+		static vector<size_t> minMax(const vector<float> &y, size_t buckets);
+
+		/// Largest Triangle Three Buckets downsample a whole series.
+		///
+		/// See Sveinn Steinarsson, "Downsampling Time Series for Visual
+		/// Representation", 2013.
+		///
+		/// \param x X values, the same size as y.
+		/// \param y Y values.
+		/// \param threshold Desired number of output points, minimum of 3.
+		/// \returns ascending point indices
+		static vector<size_t> lttb(const vector<double> &x, const vector<float> &y, size_t threshold);
+
+	/// \section Util
+
+		/// Get the number of points in the series.
+		size_t size() const;
+
+		/// Is the series empty?
+		bool empty() const;
+
+		/// Get the x value of a point.
+		double getX(size_t index) const;
+
+		/// Get the y value of a point.
+		float getY(size_t index) const;
+
+		/// Get the number of pyramid levels.
+		size_t getNumLevels() const;
+
+	protected:
+
+		/// min & max y point index per bucket
+		struct Level {
+			size_t bucketSize;  //< number of points per bucket
+			vector<size_t> min; //< index of min y per bucket
+			vector<size_t> max; //< index of max y per bucket
+		};
+
+		/// build the pyramid levels from the current series
+		void buildPyramid();
+
+		/// point index range [first, last) covering a view, plus one point on
+		/// either side for line continuity
+		void getRange(double minX, double maxX, size_t &first, size_t &last) const;
+
+		/// LTTB over a subset of points
+		static vector<size_t> lttb(const vector<double> &x, const vector<float> &y,
+		                           const vector<size_t> &points, size_t threshold);
+
+		vector<double> xs;     //< x values
+		vector<float> ys;      //< y values
+		vector<Level> pyramid; //< min/max levels, finest first
+};
@@ -0,0 +1,58 @@
+/**
+ *  ofxCsvError.cpp
+ *  Inspired and based on Ben Fry's [table class](http://benfry.com/writing/map/Table.pde)
+ *
+ *  The MIT License
+ *
+ *  Copyright (c) 2011-2019 Paul Vollmer, https://paulvollmer.net
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ *
+ *  @modified           2026.10.18
+ *  @version            0.2.1
+ */
+
+#include "ofxCsvError.h"
+
+//--------------------------------------------------
+string ofxCsvError::getDescription() const {
+	switch(type) {
+		case UNTERMINATED_QUOTE:
+			return "unterminated quote";
+		case STRAY_QUOTE:
+			return "quote inside unquoted field";
+		case TEXT_AFTER_QUOTE:
+			return "text after closing quote";
+		case COLUMN_COUNT:
+			return "unexpected number of cols";
+	}
+	return "unknown error";
+}
+
+//--------------------------------------------------
+string ofxCsvError::toString() const {
+	return "line " + std::to_string(line) + ", col " + std::to_string(col) +
+	       " (byte " + std::to_string(offset) + "): " + getDescription();
+}
+
+//--------------------------------------------------
+ostream& operator<<(ostream &ostr, const ofxCsvError &error) {
+	ostr << error.toString();
+	return ostr;
+}
@@ -0,0 +1,75 @@
+/**
+ *  ofxCsvError.h
+ *  Inspired and based on Ben Fry's [table class](http://benfry.com/writing/map/Table.pde)
+ *
+ *  The MIT License
+ *
+ *  Copyright (c) 2011-2019 Paul Vollmer, https://paulvollmer.net
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ *
+ *  @modified           2026.10.18
+ *  @version            0.2.1
+ */
+
+#pragma once
+
+#include "ofConstants.h"
+
+/// \class ofxCsvError
+/// \brief a malformed row found when loading in strict mode
+///
+/// Positions refer to the source file: line & col numbers start at 1 & the
+/// byte offset is from the beginning of the file.
+struct ofxCsvError {
+
+	/// error type
+	enum Type {
+		UNTERMINATED_QUOTE, //< quoted field missing its closing quote: "hello
+		STRAY_QUOTE,        //< quote inside an unquoted field: hel"lo
+		TEXT_AFTER_QUOTE,   //< text between a closing quote & separator: "hello"world
+		COLUMN_COUNT        //< more or fewer cols than expected
+	};
+
+	Type type;       //< error type
+	uint64_t offset; //< byte offset of the error
+	size_t line;     //< line number
+	size_t col;      //< char column within the line
+	size_t field;    //< field index within the row, starting at 0
+
+	ofxCsvError() : type(UNTERMINATED_QUOTE), offset(0), line(0), col(0), field(0) {}
+
+	/// Get a description of the error type.
+	string getDescription() const;
+
+	/// Get the error as a readable string,
+	/// ie. "line 12, col 5 (byte 301): unterminated quote"
+	string toString() const;
+
+	/// Streams the error as a readable string.
+	friend ostream& operator<<(ostream &ostr, const ofxCsvError &error);
+};
+
+/// strict mode policy for malformed rows when loading
+enum ofxCsvStrictMode {
+	OFXCSV_STRICT_OFF,    //< accept all rows without checking, default
+	OFXCSV_STRICT_SKIP,   //< drop malformed rows & keep loading
+	OFXCSV_STRICT_STOP,   //< stop loading at the first malformed row
+	OFXCSV_STRICT_COLLECT //< keep malformed rows & stop after max errors
+};
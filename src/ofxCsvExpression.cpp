@@ -0,0 +1,536 @@
+/**
+ *  ofxCsvExpression.cpp
+ *  Inspired and based on Ben Fry's [table class](http://benfry.com/writing/map/Table.pde)
+ *
+ *  The MIT License
+ *
+ *  Copyright (c) 2011-2019 Paul Vollmer, https://paulvollmer.net
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ *
+ *  @modified           2026.10.18
+ *  @version            0.2.1
+ */
+
+#include "ofxCsvExpression.h"
+
+#include "ofxCsvFormat.h"
+#include "ofxCsvParse.h"
+#include "ofLog.h"
+
+#include <cctype>
+#include <cmath>
+
+/// apply f to each value of a batch in place
+template<typename F>
+static inline void unary(double *a, size_t n, F f) {
+	for(size_t i = 0; i < n; i++) {
+		a[i] = f(a[i]);
+	}
+}
+
+/// apply f to pairs of values of 2 batches, storing in the first
+template<typename F>
+static inline void binary(double *a, const double *b, size_t n, F f) {
+	for(size_t i = 0; i < n; i++) {
+		a[i] = f(a[i], b[i]);
+	}
+}
+
+//--------------------------------------------------
+const size_t ofxCsvExpression::batchSize;
+
+//--------------------------------------------------
+ofxCsvExpression::ofxCsvExpression() {
+	depth = 0;
+	maxDepth = 0;
+	pos = 0;
+}
+
+//--------------------------------------------------
+ofxCsvExpression::ofxCsvExpression(const string &expression) : ofxCsvExpression() {
+	parse(expression);
+}
+
+/// PARSING
+
+//--------------------------------------------------
+bool ofxCsvExpression::parse(const string &expression) {
+	this->expression = expression;
+	program.clear();
+	variables.clear();
+	depth = 0;
+	maxDepth = 0;
+	pos = 0;
+	error.clear();
+
+	bool ok = parseComparison();
+	if(ok) {
+		skipWhitespace();
+		if(pos < expression.size()) {
+			ok = fail("unexpected '" + expression.substr(pos, 1) + "'");
+		}
+	}
+	if(!ok) {
+		ofLogError("ofxCsvExpression") << "Cannot parse \"" << expression << "\": " << error;
+		program.clear();
+		variables.clear();
+		return false;
+	}
+	return true;
+}
+
+//--------------------------------------------------
+bool ofxCsvExpression::isValid() const {
+	return !program.empty();
+}
+
+//--------------------------------------------------
+string ofxCsvExpression::getExpression() const {
+	return expression;
+}
+
+//--------------------------------------------------
+const vector<string>& ofxCsvExpression::getVariables() const {
+	return variables;
+}
+
+/// EVALUATION
+
+//--------------------------------------------------
+bool ofxCsvExpression::evaluate(const vector<const ofxCsvColumn<double>*> &columns, size_t size,
+                                ofxCsvColumn<double> &out) const {
+	out.clear();
+	if(program.empty()) {
+		ofLogError("ofxCsvExpression") << "Cannot evaluate: no valid expression";
+		return false;
+	}
+	if(columns.size() != variables.size()) {
+		ofLogError("ofxCsvExpression") << "Cannot evaluate \"" << expression << "\": expected "
+			<< variables.size() << " columns, got " << columns.size();
+		return false;
+	}
+	for(auto column : columns) {
+		if(!column) {
+			ofLogError("ofxCsvExpression") << "Cannot evaluate \"" << expression << "\": null column";
+			return false;
+		}
+	}
+	out.reserve(size);
+
+	// 1 batch per stack slot & the batch's validity bitmap
+	vector<double> stack(maxDepth * batchSize);
+	const size_t words = batchSize / 64;
+	uint64_t valid[words];
+
+	for(size_t start = 0; start < size; start += batchSize) {
+		size_t n = min(batchSize, size - start);
+
+		// rows are valid if all variables are, batches are word aligned
+		for(size_t w = 0; w < words; w++) {
+			valid[w] = ~0ULL;
+		}
+		for(auto column : columns) {
+			const vector<uint64_t> &validity = column->getValidity();
+			size_t first = start / 64;
+			for(size_t w = 0; w < words; w++) {
+				valid[w] &= first + w < validity.size() ? validity[first + w] : 0;
+			}
+		}
+
+		// run the program over the batch
+		double *base = stack.data();
+		size_t top = 0;
+		for(const Op &op : program) {
+			double *a = base + (top > 0 ? top - 1 : 0) * batchSize; // top
+			double *b = base + top * batchSize;                     // above top
+			switch(op.code) {
+				case CONSTANT:
+					for(size_t i = 0; i < n; i++) {
+						b[i] = op.value;
+					}
+					top++;
+					continue;
+				case VARIABLE: {
+					const ofxCsvColumn<double> &column = *columns[op.index];
+					size_t count = column.size() > start ? min(n, column.size() - start) : 0;
+					const double *values = column.getValues().data() + start;
+					for(size_t i = 0; i < count; i++) {
+						b[i] = values[i];
+					}
+					for(size_t i = count; i < n; i++) {
+						b[i] = 0;
+					}
+					top++;
+					continue;
+				}
+				case NEGATE: unary(a, n, [](double x) {return -x;}); continue;
+				case ABS:   unary(a, n, [](double x) {return std::fabs(x);}); continue;
+				case SQRT:  unary(a, n, [](double x) {return std::sqrt(x);}); continue;
+				case EXP:   unary(a, n, [](double x) {return std::exp(x);}); continue;
+				case LOG:   unary(a, n, [](double x) {return std::log(x);}); continue;
+				case LOG10: unary(a, n, [](double x) {return std::log10(x);}); continue;
+				case SIN:   unary(a, n, [](double x) {return std::sin(x);}); continue;
+				case COS:   unary(a, n, [](double x) {return std::cos(x);}); continue;
+				case TAN:   unary(a, n, [](double x) {return std::tan(x);}); continue;
+				case ASIN:  unary(a, n, [](double x) {return std::asin(x);}); continue;
+				case ACOS:  unary(a, n, [](double x) {return std::acos(x);}); continue;
+				case ATAN:  unary(a, n, [](double x) {return std::atan(x);}); continue;
+				case FLOOR: unary(a, n, [](double x) {return std::floor(x);}); continue;
+				case CEIL:  unary(a, n, [](double x) {return std::ceil(x);}); continue;
+				case ROUND: unary(a, n, [](double x) {return std::round(x);}); continue;
+				default:
+					break;
+			}
+
+			// binary operations pop the top into the one below
+			top--;
+			b = a;
+			a -= batchSize;
+			switch(op.code) {
+				case ADD:           binary(a, b, n, [](double x, double y) {return x + y;}); break;
+				case SUBTRACT:      binary(a, b, n, [](double x, double y) {return x - y;}); break;
+				case MULTIPLY:      binary(a, b, n, [](double x, double y) {return x * y;}); break;
+				case DIVIDE:        binary(a, b, n, [](double x, double y) {return x / y;}); break;
+				case MODULO:        binary(a, b, n, [](double x, double y) {return std::fmod(x, y);}); break;
+				case POWER:         binary(a, b, n, [](double x, double y) {return std::pow(x, y);}); break;
+				case LESS:          binary(a, b, n, [](double x, double y) {return (double)(x < y);}); break;
+				case LESS_EQUAL:    binary(a, b, n, [](double x, double y) {return (double)(x <= y);}); break;
+				case GREATER:       binary(a, b, n, [](double x, double y) {return (double)(x > y);}); break;
+				case GREATER_EQUAL: binary(a, b, n, [](double x, double y) {return (double)(x >= y);}); break;
+				case EQUAL:         binary(a, b, n, [](double x, double y) {return (double)(x == y);}); break;
+				case NOT_EQUAL:     binary(a, b, n, [](double x, double y) {return (double)(x != y);}); break;
+				case ATAN2:         binary(a, b, n, [](double x, double y) {return std::atan2(x, y);}); break;
+				case MIN:           binary(a, b, n, [](double x, double y) {return y < x ? y : x;}); break;
+				case MAX:           binary(a, b, n, [](double x, double y) {return x < y ? y : x;}); break;
+				case HYPOT:         binary(a, b, n, [](double x, double y) {return std::hypot(x, y);}); break;
+				default:
+					break;
+			}
+		}
+
+		// the result is the only batch left
+		for(size_t i = 0; i < n; i++) {
+			if(valid[i / 64] & (1ULL << (i % 64))) {
+				out.push(stack[i]);
+			}
+			else {
+				out.pushNull();
+			}
+		}
+	}
+	return true;
+}
+
+// PROTECTED
+
+//--------------------------------------------------
+void ofxCsvExpression::emit(OpCode code, double value, size_t index) {
+	Op op;
+	op.code = code;
+	op.value = value;
+	op.index = index;
+	program.push_back(op);
+	if(code == CONSTANT || code == VARIABLE) {
+		depth++;
+		maxDepth = max(maxDepth, depth);
+	}
+	else if((code >= ADD && code <= NOT_EQUAL) || code >= ATAN2) {
+		depth--;
+	}
+}
+
+//--------------------------------------------------
+bool ofxCsvExpression::fail(const string &message) {
+	if(error.empty()) {
+		error = message + " at " + ofxCsvFormat::toString(pos);
+	}
+	return false;
+}
+
+//--------------------------------------------------
+void ofxCsvExpression::skipWhitespace() {
+	while(pos < expression.size() && isspace((unsigned char)expression[pos])) {
+		pos++;
+	}
+}
+
+//--------------------------------------------------
+bool ofxCsvExpression::accept(char c) {
+	skipWhitespace();
+	if(pos < expression.size() && expression[pos] == c) {
+		pos++;
+		return true;
+	}
+	return false;
+}
+
+//--------------------------------------------------
+bool ofxCsvExpression::parseComparison() {
+	if(!parseSum()) {
+		return false;
+	}
+	OpCode code;
+	if(accept('<')) {
+		code = accept('=') ? LESS_EQUAL : LESS;
+	}
+	else if(accept('>')) {
+		code = accept('=') ? GREATER_EQUAL : GREATER;
+	}
+	else if(accept('=')) {
+		if(!accept('=')) {
+			return fail("expected '=='");
+		}
+		code = EQUAL;
+	}
+	else if(accept('!')) {
+		if(!accept('=')) {
+			return fail("expected '!='");
+		}
+		code = NOT_EQUAL;
+	}
+	else {
+		return true;
+	}
+	if(!parseSum()) {
+		return false;
+	}
+	emit(code);
+	return true;
+}
+
+//--------------------------------------------------
+bool ofxCsvExpression::parseSum() {
+	if(!parseProduct()) {
+		return false;
+	}
+	while(true) {
+		OpCode code;
+		if(accept('+')) {
+			code = ADD;
+		}
+		else if(accept('-')) {
+			code = SUBTRACT;
+		}
+		else {
+			return true;
+		}
+		if(!parseProduct()) {
+			return false;
+		}
+		emit(code);
+	}
+}
+
+//--------------------------------------------------
+bool ofxCsvExpression::parseProduct() {
+	if(!parseUnary()) {
+		return false;
+	}
+	while(true) {
+		OpCode code;
+		if(accept('*')) {
+			code = MULTIPLY;
+		}
+		else if(accept('/')) {
+			code = DIVIDE;
+		}
+		else if(accept('%')) {
+			code = MODULO;
+		}
+		else {
+			return true;
+		}
+		if(!parseUnary()) {
+			return false;
+		}
+		emit(code);
+	}
+}
+
+//--------------------------------------------------
+bool ofxCsvExpression::parseUnary() {
+	if(accept('-')) {
+		if(!parseUnary()) {
+			return false;
+		}
+		emit(NEGATE);
+		return true;
+	}
+	if(accept('+')) {
+		return parseUnary();
+	}
+	return parsePower();
+}
+
+//--------------------------------------------------
+bool ofxCsvExpression::parsePower() {
+	if(!parsePrimary()) {
+		return false;
+	}
+	if(accept('^')) {
+		// right associative & binds tighter than unary minus on its left,
+		// ie. -2^2 is -4 & 2^-1 is 0.5
+		if(!parseUnary()) {
+			return false;
+		}
+		emit(POWER);
+	}
+	return true;
+}
+
+//--------------------------------------------------
+bool ofxCsvExpression::parsePrimary() {
+	skipWhitespace();
+	if(pos >= expression.size()) {
+		return fail("unexpected end");
+	}
+	const char *begin = expression.c_str() + pos;
+	char c = *begin;
+
+	// parenthesis
+	if(accept('(')) {
+		if(!parseComparison()) {
+			return false;
+		}
+		if(!accept(')')) {
+			return fail("expected ')'");
+		}
+		return true;
+	}
+
+	// number, always with a '.' decimal mark whatever the locale
+	if(isdigit((unsigned char)c) || c == '.') {
+		const char *end = begin;
+		int marks = 0;
+		while(isdigit((unsigned char)*end) || *end == '.') {
+			marks += *end == '.';
+			end++;
+		}
+		if((*end == 'e' || *end == 'E') &&
+		   (isdigit((unsigned char)end[1]) ||
+		    ((end[1] == '-' || end[1] == '+') && isdigit((unsigned char)end[2])))) {
+			end += 2;
+			while(isdigit((unsigned char)*end)) {
+				end++;
+			}
+		}
+		double value = 0;
+		if(marks > 1 || !ofxCsvParse::toDouble(begin, end, value)) {
+			return fail("invalid number");
+		}
+		pos += end - begin;
+		emit(CONSTANT, value);
+		return true;
+	}
+
+	// col number variable
+	if(c == '$') {
+		size_t end = pos + 1;
+		while(end < expression.size() && isdigit((unsigned char)expression[end])) {
+			end++;
+		}
+		if(end == pos + 1) {
+			return fail("expected col number after '$'");
+		}
+		addVariable(expression.substr(pos, end - pos));
+		pos = end;
+		return true;
+	}
+
+	// bracketed variable name
+	if(c == '[') {
+		size_t end = expression.find(']', pos + 1);
+		if(end == string::npos) {
+			return fail("expected ']'");
+		}
+		addVariable(expression.substr(pos + 1, end - pos - 1));
+		pos = end + 1;
+		return true;
+	}
+
+	// name: function, constant, or variable
+	if(isalpha((unsigned char)c) || c == '_') {
+		size_t end = pos + 1;
+		while(end < expression.size() &&
+		      (isalnum((unsigned char)expression[end]) || expression[end] == '_' || expression[end] == '.')) {
+			end++;
+		}
+		string name = expression.substr(pos, end - pos);
+		pos = end;
+		if(accept('(')) {
+			return parseCall(name);
+		}
+		if(name == "pi") {
+			emit(CONSTANT, 3.14159265358979323846);
+		}
+		else {
+			addVariable(name);
+		}
+		return true;
+	}
+
+	return fail("unexpected '" + string(1, c) + "'");
+}
+
+//--------------------------------------------------
+bool ofxCsvExpression::parseCall(const string &name) {
+	// function names & their operations
+	static const struct {
+		const char *name;
+		OpCode code;
+		int args;
+	} functions[] = {
+		{"abs", ABS, 1}, {"sqrt", SQRT, 1}, {"exp", EXP, 1}, {"log", LOG, 1}, {"log10", LOG10, 1},
+		{"sin", SIN, 1}, {"cos", COS, 1}, {"tan", TAN, 1}, {"asin", ASIN, 1}, {"acos", ACOS, 1},
+		{"atan", ATAN, 1}, {"floor", FLOOR, 1}, {"ceil", CEIL, 1}, {"round", ROUND, 1},
+		{"atan2", ATAN2, 2}, {"min", MIN, 2}, {"max", MAX, 2}, {"hypot", HYPOT, 2}
+	};
+	for(auto &function : functions) {
+		if(name != function.name) {
+			continue;
+		}
+		for(int i = 0; i < function.args; i++) {
+			if(i > 0 && !accept(',')) {
+				return fail("expected ',' in " + name + "()");
+			}
+			if(!parseComparison()) {
+				return false;
+			}
+		}
+		if(!accept(')')) {
+			return fail("expected ')' after " + name + "() arguments");
+		}
+		emit(function.code);
+		return true;
+	}
+	return fail("unknown function " + name + "()");
+}
+
+//--------------------------------------------------
+void ofxCsvExpression::addVariable(const string &name) {
+	size_t index = 0;
+	while(index < variables.size() && variables[index] != name) {
+		index++;
+	}
+	if(index == variables.size()) {
+		variables.push_back(name);
+	}
+	emit(VARIABLE, 0, index);
+}
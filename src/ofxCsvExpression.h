@@ -0,0 +1,163 @@
+/**
+ *  ofxCsvExpression.h
+ *  Inspired and based on Ben Fry's [table class](http://benfry.com/writing/map/Table.pde)
+ *
+ *  The MIT License
+ *
+ *  Copyright (c) 2011-2019 Paul Vollmer, https://paulvollmer.net
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ *
+ *  @modified           2026.10.18
+ *  @version            0.2.1
+ */
+
+#pragma once
+
+#include "ofxCsvColumn.h"
+
+/// \class ofxCsvExpression
+/// \brief arithmetic expression over columns, evaluated a batch at a time
+///
+/// The expression is compiled once into a list of operations, which are
+/// then run over 1024 rows at a time instead of interpreting the expression
+/// for each row. Each operation is a tight loop over a batch of doubles the
+/// compiler can vectorize:
+///
+///     ofxCsvExpression speed;
+///     speed.parse("sqrt(dx*dx + dy*dy)");
+///
+///     // one input col per variable, in getVariables() order: dx, dy
+///     ofxCsvColumn<double> result;
+///     speed.evaluate({&dx, &dy}, dx.size(), result);
+///
+/// Syntax:
+///   * numbers: 1, 0.5, 1e-3, & the constant pi
+///   * variables: names, ie. dx, [names with spaces], or $2 for col 2
+///   * operators: + - * / % ^ (power), unary -, & parentheses
+///   * comparisons: < <= > >= == != give 1 or 0
+///   * functions: abs sqrt exp log log10 sin cos tan asin acos atan floor
+///     ceil round, & atan2 pow min max hypot with 2 arguments
+///
+/// A result is null if any of its variables is null for that row.
+class ofxCsvExpression {
+
+	public:
+
+		/// number of rows evaluated at a time
+		static const size_t batchSize = 1024;
+
+		/// Constructor.
+		ofxCsvExpression();
+
+		/// Create & parse an expression.
+		ofxCsvExpression(const string &expression);
+
+	/// \section Parsing
+
+		/// Parse & compile an expression.
+		///
+		/// Clears any current expression.
+		///
+		/// \param expression Expression text, ie. "sqrt(dx*dx + dy*dy)".
+		/// \returns true if the expression is valid
+		bool parse(const string &expression);
+
+		/// Is a valid expression loaded?
+		bool isValid() const;
+
+		/// Get the expression text.
+		string getExpression() const;
+
+		/// Get the variable names in order of first use, without brackets,
+		/// ie. "dx" or "$2".
+		const vector<string>& getVariables() const;
+
+	/// \section Evaluation
+
+		/// Evaluate for a number of rows.
+		///
+		/// Rows past the end of an input col are null.
+		///
+		/// \param columns Input cols, one per variable in getVariables() order.
+		/// \param size Number of rows to evaluate.
+		/// \param out Cleared & set to the results.
+		/// \returns false if the expression isn't valid or the number of
+		///          cols doesn't match
+		bool evaluate(const vector<const ofxCsvColumn<double>*> &columns, size_t size,
+		              ofxCsvColumn<double> &out) const;
+
+	protected:
+
+		/// operation codes
+		enum OpCode {
+			CONSTANT, // push a value
+			VARIABLE, // push a batch of an input col
+			NEGATE,
+			ADD, SUBTRACT, MULTIPLY, DIVIDE, MODULO, POWER,
+			LESS, LESS_EQUAL, GREATER, GREATER_EQUAL, EQUAL, NOT_EQUAL,
+			ABS, SQRT, EXP, LOG, LOG10, SIN, COS, TAN, ASIN, ACOS, ATAN,
+			FLOOR, CEIL, ROUND,
+			ATAN2, MIN, MAX, HYPOT
+		};
+
+		/// a compiled operation on the batch stack
+		struct Op {
+			OpCode code;  //< operation
+			double value; //< CONSTANT value
+			size_t index; //< VARIABLE index
+		};
+
+		/// add an operation, tracking the stack depth
+		void emit(OpCode code, double value=0, size_t index=0);
+
+		/// record a syntax error at the current position
+		/// \returns false
+		bool fail(const string &message);
+
+		/// skip whitespace at the current position
+		void skipWhitespace();
+
+		/// skip whitespace & consume a char if it's next
+		/// \returns true if the char was consumed
+		bool accept(char c);
+
+		/// recursive descent from lowest to highest precedence, each
+		/// emits its operations in evaluation order
+		bool parseComparison();
+		bool parseSum();
+		bool parseProduct();
+		bool parseUnary();
+		bool parsePower();
+		bool parsePrimary();
+
+		/// parse a function call's arguments after its name
+		bool parseCall(const string &name);
+
+		/// add a variable reference
+		void addVariable(const string &name);
+
+		string expression;         //< expression text
+		vector<Op> program;        //< compiled operations
+		vector<string> variables;  //< variable names
+		size_t depth;              //< current stack depth while parsing
+		size_t maxDepth;           //< max stack depth
+		size_t pos;                //< parse position
+		string error;              //< parse error
+};
@@ -0,0 +1,478 @@
+/**
+ *  ofxCsvExternalSort.cpp
+ *  Inspired and based on Ben Fry's [table class](http://benfry.com/writing/map/Table.pde)
+ *
+ *  The MIT License
+ *
+ *  Copyright (c) 2011-2019 Paul Vollmer, https://paulvollmer.net
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ *
+ *  @modified           2026.10.18
+ *  @version            0.2.1
+ */
+
+#include "ofxCsvExternalSort.h"
+
+#include "ofxCsvParse.h"
+#include "ofLog.h"
+#include "ofUtils.h"
+#include "ofFileUtils.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <thread>
+
+/// file write buffer size
+static const size_t s_bufferSize = 1 << 20;
+
+//--------------------------------------------------
+ofxCsvExternalSort::ofxCsvExternalSort() {
+	memoryBudget = 256 * 1024 * 1024;
+	header = true;
+	threads = 0;
+	numRows = 0;
+}
+
+/// SETUP
+
+//--------------------------------------------------
+void ofxCsvExternalSort::addKey(int col, KeyType type, bool ascending) {
+	KeySpec spec = {max(col, 0), type, ascending, ofxCsvTimestamp()};
+	keySpecs.push_back(spec);
+}
+
+//--------------------------------------------------
+void ofxCsvExternalSort::addKey(int col, const ofxCsvTimestamp &timestamp, bool ascending) {
+	KeySpec spec = {max(col, 0), TIMESTAMP, ascending, timestamp};
+	keySpecs.push_back(spec);
+}
+
+//--------------------------------------------------
+void ofxCsvExternalSort::clearKeys() {
+	keySpecs.clear();
+}
+
+//--------------------------------------------------
+void ofxCsvExternalSort::setMemoryBudget(size_t bytes) {
+	memoryBudget = bytes;
+}
+
+//--------------------------------------------------
+void ofxCsvExternalSort::setHeader(bool header) {
+	this->header = header;
+}
+
+//--------------------------------------------------
+void ofxCsvExternalSort::setThreads(unsigned int threads) {
+	this->threads = threads;
+}
+
+//--------------------------------------------------
+void ofxCsvExternalSort::setTempDirectory(const string &path) {
+	tempDirectory = path;
+}
+
+/// SORTING
+
+//--------------------------------------------------
+bool ofxCsvExternalSort::sort(const string &input, const string &output,
+                              const string &separator, const string &comment) {
+	numRows = 0;
+	runPaths.clear();
+	if(keySpecs.empty()) {
+		ofLogWarning("ofxCsvExternalSort") << "No sort keys set, sorting by the first col";
+		addKey(0);
+	}
+
+	ofxCsvReader reader;
+	if(!reader.open(input, separator, comment)) {
+		return false;
+	}
+	string outPath = ofToDataPath(output, true);
+	if(outPath == reader.getPath() || outPath == ofToDataPath(input, true)) {
+		ofLogError("ofxCsvExternalSort") << "Cannot sort " << input << ": output is the input file";
+		return false;
+	}
+
+	// temp run files are named after the output
+	string dir = tempDirectory.empty() ?
+		ofFilePath::getEnclosingDirectory(outPath, false) : ofToDataPath(tempDirectory, true);
+	if(!ofDirectory::doesDirectoryExist(dir, false) && !ofDirectory::createDirectory(dir, false, true)) {
+		ofLogError("ofxCsvExternalSort") << "Cannot sort " << input << ": couldn't create " << dir;
+		return false;
+	}
+	string runBase = ofFilePath::join(dir, ofFilePath::getFileName(outPath));
+	auto addRun = [&]() {
+		char num[32];
+		snprintf(num, sizeof(num), ".run%04zu.tmp", runPaths.size());
+		runPaths.push_back(runBase + num);
+	};
+
+	// read chunks, spilling each sorted chunk to a run when over budget
+	string headerLine;
+	size_t numKeys = keySpecs.size();
+	size_t rowBytes = 2 * sizeof(size_t) + numKeys * sizeof(Key) + sizeof(uint32_t);
+	size_t chunkBytes = 0;
+	bool first = header;
+	bool ok = true;
+	chunkText.clear();
+	lineOffsets.clear();
+	lineSizes.clear();
+	chunkKeys.clear();
+	while(reader.next()) {
+		const ofxCsvRowView &row = reader.getRow();
+		if(first) {
+			headerLine.assign(row.getLineData(), row.getLineSize());
+			first = false;
+			continue;
+		}
+		size_t size = chunkText.size();
+		lineOffsets.push_back(size);
+		lineSizes.push_back(row.getLineSize());
+		chunkText.append(row.getLineData(), row.getLineSize());
+		chunkKeys.resize(chunkKeys.size() + numKeys);
+		extractKeys(row, &chunkKeys[chunkKeys.size() - numKeys], chunkText);
+		chunkBytes += (chunkText.size() - size) + rowBytes;
+		numRows++;
+		if(chunkBytes >= memoryBudget || lineOffsets.size() == UINT32_MAX) {
+			sortChunk();
+			addRun();
+			if(!writeRun(runPaths.back())) {
+				ok = false;
+				break;
+			}
+			chunkText.clear();
+			lineOffsets.clear();
+			lineSizes.clear();
+			chunkKeys.clear();
+			chunkBytes = 0;
+		}
+	}
+	reader.close();
+
+	// open output
+	FILE *out = nullptr;
+	if(ok) {
+		ofFile info(outPath, ofFile::Reference);
+		if(!info.exists()) {
+			ofFile create(outPath, ofFile::WriteOnly, false);
+			create.create();
+		}
+		out = fopen(outPath.c_str(), "wb");
+		if(!out) {
+			ofLogError("ofxCsvExternalSort") << "Cannot sort " << input << ": couldn't write " << output;
+			ok = false;
+		}
+	}
+	if(ok) {
+		setvbuf(out, nullptr, _IOFBF, s_bufferSize);
+		if(header && !headerLine.empty()) {
+			headerLine += '\n';
+			ok = fwrite(headerLine.data(), 1, headerLine.size(), out) == headerLine.size();
+		}
+	}
+
+	// the last chunk is sorted in memory, written straight to the output if
+	// it's the only one, otherwise spilled & merged with the other runs
+	if(ok) {
+		sortChunk();
+		if(runPaths.empty()) {
+			ok = writeChunk(out);
+		}
+		else {
+			if(!lineOffsets.empty()) {
+				addRun();
+				ok = writeRun(runPaths.back());
+			}
+			chunkText.clear();
+			chunkText.shrink_to_fit();
+			lineOffsets = vector<size_t>();
+			lineSizes = vector<size_t>();
+			chunkKeys = vector<Key>();
+			order = vector<uint32_t>();
+			ok = ok && mergeRuns(out, separator);
+		}
+	}
+	if(out) {
+		ok = (fclose(out) == 0) && ok;
+	}
+	removeRuns();
+	chunkText.clear();
+	lineOffsets.clear();
+	lineSizes.clear();
+	chunkKeys.clear();
+	order.clear();
+	if(!ok) {
+		ofLogError("ofxCsvExternalSort") << "Could not sort " << input << " to " << output;
+		return false;
+	}
+
+	ofLogVerbose("ofxCsvExternalSort") << "Sorted " << numRows << " rows from " << input
+	                                   << " to " << output << " using " << getNumRuns() << " runs";
+	return true;
+}
+
+//--------------------------------------------------
+size_t ofxCsvExternalSort::getNumRows() const {
+	return numRows;
+}
+
+//--------------------------------------------------
+size_t ofxCsvExternalSort::getNumRuns() const {
+	return runPaths.size();
+}
+
+// PROTECTED
+
+//--------------------------------------------------
+void ofxCsvExternalSort::extractKeys(const ofxCsvRowView &row, Key *keys, string &text) const {
+	string unquoted;
+	for(size_t k = 0; k < keySpecs.size(); k++) {
+		const KeySpec &spec = keySpecs[k];
+		Key &key = keys[k];
+		key.number = NAN;
+		key.time = std::numeric_limits<int64_t>::min();
+		key.offset = text.size();
+		key.size = 0;
+		if((size_t)spec.col >= row.size()) {
+			continue;
+		}
+		const ofxCsvFieldView &field = row[spec.col];
+		const char *data = field.data;
+		size_t size = field.size;
+		if(field.quoted) {
+			field.str(unquoted);
+			data = unquoted.data();
+			size = unquoted.size();
+		}
+		switch(spec.type) {
+			case NUMBER: {
+				double v = 0;
+				if(size > 0 && ofxCsvParse::toDouble(data, data + size, v)) {
+					key.number = v;
+				}
+				break;
+			}
+			case STRING:
+				text.append(data, size);
+				key.size = size;
+				break;
+			case TIMESTAMP:
+				spec.timestamp.parse(data, data + size, key.time);
+				break;
+		}
+	}
+}
+
+//--------------------------------------------------
+int ofxCsvExternalSort::compare(const Key *a, const char *aText, const Key *b, const char *bText) const {
+	for(size_t k = 0; k < keySpecs.size(); k++) {
+		int c = 0;
+		switch(keySpecs[k].type) {
+			case NUMBER: {
+				bool aNan = std::isnan(a[k].number), bNan = std::isnan(b[k].number);
+				if(aNan || bNan) { // missing values last, whatever the direction
+					if(aNan != bNan) {
+						return aNan ? 1 : -1;
+					}
+					continue;
+				}
+				c = (a[k].number < b[k].number) ? -1 : (a[k].number > b[k].number);
+				break;
+			}
+			case TIMESTAMP: {
+				const int64_t missing = std::numeric_limits<int64_t>::min();
+				if(a[k].time == missing || b[k].time == missing) { // missing values last
+					if(a[k].time != b[k].time) {
+						return (a[k].time == missing) ? 1 : -1;
+					}
+					continue;
+				}
+				c = (a[k].time < b[k].time) ? -1 : (a[k].time > b[k].time);
+				break;
+			}
+			case STRING:
+				c = memcmp(aText + a[k].offset, bText + b[k].offset, min(a[k].size, b[k].size));
+				if(c == 0) {
+					c = (a[k].size < b[k].size) ? -1 : (a[k].size > b[k].size);
+				}
+				break;
+		}
+		if(c != 0) {
+			return keySpecs[k].ascending ? c : -c;
+		}
+	}
+	return 0;
+}
+
+//--------------------------------------------------
+void ofxCsvExternalSort::sortChunk() {
+	size_t count = lineOffsets.size();
+	size_t numKeys = keySpecs.size();
+	order.resize(count);
+	for(size_t i = 0; i < count; i++) {
+		order[i] = i;
+	}
+
+	// ties keep input order, so the sort is stable
+	const char *text = chunkText.data();
+	const Key *keys = chunkKeys.data();
+	auto less = [&](uint32_t a, uint32_t b) {
+		int c = compare(keys + a * numKeys, text, keys + b * numKeys, text);
+		return c < 0 || (c == 0 && a < b);
+	};
+
+	// sort slices in parallel, then merge slice pairs until one is left
+	size_t numThreads = threads > 0 ? threads : max(std::thread::hardware_concurrency(), 1u);
+	numThreads = max<size_t>(min<size_t>(numThreads, count / 4096), 1);
+	vector<size_t> bounds;
+	for(size_t t = 0; t <= numThreads; t++) {
+		bounds.push_back(count * t / numThreads);
+	}
+	vector<std::thread> workers;
+	for(size_t t = 1; t < numThreads; t++) {
+		workers.emplace_back([&, t] {
+			std::sort(order.begin() + bounds[t], order.begin() + bounds[t+1], less);
+		});
+	}
+	std::sort(order.begin() + bounds[0], order.begin() + bounds[1], less);
+	for(auto &worker : workers) {
+		worker.join();
+	}
+	for(size_t width = 1; width < numThreads; width *= 2) {
+		workers.clear();
+		for(size_t t = 0; t + width < numThreads; t += 2 * width) {
+			size_t last = min(t + 2 * width, numThreads);
+			workers.emplace_back([&, t, width, last] {
+				std::inplace_merge(order.begin() + bounds[t], order.begin() + bounds[t + width],
+				                   order.begin() + bounds[last], less);
+			});
+		}
+		for(auto &worker : workers) {
+			worker.join();
+		}
+	}
+}
+
+//--------------------------------------------------
+bool ofxCsvExternalSort::writeChunk(FILE *file) {
+	for(uint32_t i : order) {
+		if(fwrite(chunkText.data() + lineOffsets[i], 1, lineSizes[i], file) != lineSizes[i] ||
+		   fputc('\n', file) == EOF) {
+			return false;
+		}
+	}
+	return true;
+}
+
+//--------------------------------------------------
+bool ofxCsvExternalSort::writeRun(const string &path) {
+	FILE *file = fopen(path.c_str(), "wb");
+	if(!file) {
+		ofLogError("ofxCsvExternalSort") << "Cannot write run " << path;
+		return false;
+	}
+	setvbuf(file, nullptr, _IOFBF, s_bufferSize);
+	bool ok = writeChunk(file);
+	ok = (fclose(file) == 0) && ok;
+	if(!ok) {
+		ofLogError("ofxCsvExternalSort") << "Could not write run " << path;
+	}
+	return ok;
+}
+
+//--------------------------------------------------
+bool ofxCsvExternalSort::mergeRuns(FILE *out, const string &separator) {
+	size_t numKeys = keySpecs.size();
+	int k = runPaths.size();
+	vector<Run> runs(k);
+
+	// load a run's next row & its keys
+	auto advance = [&](int r) {
+		Run &run = runs[r];
+		if(!run.reader.next()) {
+			run.done = true;
+			return;
+		}
+		run.text.clear();
+		extractKeys(run.reader.getRow(), run.keys.data(), run.text);
+	};
+
+	// does run a win over run b? -1 is a sentinel which beats all runs
+	// & finished runs lose to all runs, ties go to the earlier run
+	auto beats = [&](int a, int b) {
+		if(a < 0 || b < 0) {
+			return a < 0;
+		}
+		if(runs[a].done || runs[b].done) {
+			return !runs[a].done;
+		}
+		int c = compare(runs[a].keys.data(), runs[a].text.data(), runs[b].keys.data(), runs[b].text.data());
+		return c < 0 || (c == 0 && a < b);
+	};
+
+	for(int r = 0; r < k; r++) {
+		runs[r].keys.resize(numKeys);
+		runs[r].done = false;
+		if(!runs[r].reader.open(runPaths[r], separator, "")) {
+			return false;
+		}
+		advance(r);
+	}
+
+	// loser tree: leaves are the runs, each inner node keeps the loser of
+	// its match & tree[0] the overall winner, so taking the next row only
+	// replays the matches on one leaf to root path
+	vector<int> tree(k, -1);
+	auto replay = [&](int winner) {
+		for(int node = (winner + k) / 2; node > 0; node /= 2) {
+			if(beats(tree[node], winner)) {
+				std::swap(winner, tree[node]);
+			}
+		}
+		tree[0] = winner;
+	};
+	for(int r = k - 1; r >= 0; r--) {
+		replay(r);
+	}
+	while(k > 0) {
+		int winner = tree[0];
+		Run &run = runs[winner];
+		if(run.done) {
+			break;
+		}
+		const ofxCsvRowView &row = run.reader.getRow();
+		if(fwrite(row.getLineData(), 1, row.getLineSize(), out) != row.getLineSize() ||
+		   fputc('\n', out) == EOF) {
+			return false;
+		}
+		advance(winner);
+		replay(winner);
+	}
+	return true;
+}
+
+//--------------------------------------------------
+void ofxCsvExternalSort::removeRuns() {
+	for(auto &path : runPaths) {
+		ofFile::removeFile(path, false);
+	}
+}
@@ -0,0 +1,186 @@
+/**
+ *  ofxCsvExternalSort.h
+ *  Inspired and based on Ben Fry's [table class](http://benfry.com/writing/map/Table.pde)
+ *
+ *  The MIT License
+ *
+ *  Copyright (c) 2011-2019 Paul Vollmer, https://paulvollmer.net
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ *
+ *  @modified           2026.10.18
+ *  @version            0.2.1
+ */
+
+#pragma once
+
+#include "ofxCsvReader.h"
+#include "ofxCsvTimestamp.h"
+
+/// \class ofxCsvExternalSort
+/// \brief sorts CSV files larger than memory by one or more typed key cols
+///
+/// Reads the input in chunks which fit a memory budget, sorts each chunk on
+/// several threads, writes the sorted chunks to temporary run files, & then
+/// merges the runs into the output file:
+///
+///     ofxCsvExternalSort sorter;
+///     sorter.addKey(0, ofxCsvExternalSort::TIMESTAMP); // ISO 8601 time col
+///     sorter.setMemoryBudget(512 * 1024 * 1024);      // 512 MB
+///     sorter.sort("recording.csv", "sorted.csv");
+///
+/// The sort is stable & rows are copied to the output as is, without
+/// changing their quoting. Skips empty lines & lines beginning with the
+/// comment prefix. Inputs which fit the budget are sorted in memory without
+/// any temporary files.
+///
+class ofxCsvExternalSort {
+
+	public:
+
+		/// sort key type
+		enum KeyType {
+			NUMBER,    //< numeric value, empty or non numeric fields sort last
+			STRING,    //< byte wise string comparison
+			TIMESTAMP  //< ofxCsvTimestamp time, empty or unparsable fields sort last
+		};
+
+		/// Constructor. Initializes and starts the class.
+		ofxCsvExternalSort();
+
+	/// \section Setup
+
+		/// Add a sort key col, keys are compared in the order they are added.
+		///
+		/// \param col Column number.
+		/// \param type Key type, default NUMBER.
+		/// \param ascending Sort ascending? default true.
+		void addKey(int col, KeyType type=NUMBER, bool ascending=true);
+
+		/// Add a TIMESTAMP sort key col parsed with a timestamp format.
+		///
+		/// \param col Column number.
+		/// \param timestamp Timestamp format, ie. ofxCsvTimestamp("%d/%m/%Y %T").
+		/// \param ascending Sort ascending? default true.
+		void addKey(int col, const ofxCsvTimestamp &timestamp, bool ascending=true);
+
+		/// Clear the sort keys.
+		void clearKeys();
+
+		/// Set the memory budget for the sort chunks in bytes, default 256 MB.
+		///
+		/// Merging additionally uses a read buffer of about 1 MB per run.
+		void setMemoryBudget(size_t bytes);
+
+		/// Set whether the first row is a header which is copied to the top
+		/// of the output, default true.
+		void setHeader(bool header);
+
+		/// Set the number of threads used to sort each chunk, default 0 to
+		/// use the number of hardware threads.
+		void setThreads(unsigned int threads);
+
+		/// Set the directory for the temporary run files, default "" for
+		/// the output file's directory.
+		void setTempDirectory(const string &path);
+
+	/// \section Sorting
+
+		/// Sort a CSV file.
+		///
+		/// Creates any required folders in the output path, if needed.
+		///
+		/// \param input Input file path.
+		/// \param output Output file path, must differ from the input.
+		/// \param separator Field separator string, default comma ",".
+		/// \param comment Comment line prefix string, default "#".
+		/// \returns true if the file was sorted successfully
+		bool sort(const string &input, const string &output,
+		          const string &separator=",", const string &comment="#");
+
+		/// Get the number of rows sorted by the last sort.
+		size_t getNumRows() const;
+
+		/// Get the number of temporary runs written by the last sort, 0 if
+		/// it fit into memory.
+		size_t getNumRuns() const;
+
+	protected:
+
+		/// sort key col settings
+		struct KeySpec {
+			int col;        //< column number
+			KeyType type;   //< key type
+			bool ascending; //< sort ascending?
+			ofxCsvTimestamp timestamp; //< TIMESTAMP format, default ISO 8601
+		};
+
+		/// key value for a row, text keys are stored in a separate buffer
+		struct Key {
+			double number;  //< numeric key value, NaN if not set
+			int64_t time;   //< timestamp key value, INT64_MIN if not set
+			size_t offset;  //< string key text offset
+			size_t size;    //< string key text size
+		};
+
+		/// sorted run file being merged
+		struct Run {
+			ofxCsvReader reader; //< run file reader
+			vector<Key> keys;    //< keys for the current row
+			string text;         //< key text for the current row
+			bool done;           //< has the run been fully merged?
+		};
+
+		/// compute a row's keys, appending any string key text
+		void extractKeys(const ofxCsvRowView &row, Key *keys, string &text) const;
+
+		/// compare two rows' keys
+		/// \returns < 0, 0, or > 0 like strcmp
+		int compare(const Key *a, const char *aText, const Key *b, const char *bText) const;
+
+		/// sort the current chunk on several threads, filling order
+		void sortChunk();
+
+		/// write the current chunk in sorted order to a file
+		bool writeChunk(FILE *file);
+
+		/// write the current chunk to a new temporary run file
+		bool writeRun(const string &path);
+
+		/// merge the run files into the output file
+		bool mergeRuns(FILE *out, const string &separator);
+
+		/// remove temporary run files
+		void removeRuns();
+
+		vector<KeySpec> keySpecs;  //< sort key cols
+		size_t memoryBudget;       //< chunk memory budget in bytes
+		bool header;               //< copy the first row as a header?
+		unsigned int threads;      //< chunk sort threads, 0 for hardware threads
+		string tempDirectory;      //< temporary run file directory
+
+		string chunkText;          //< current chunk lines & key text
+		vector<size_t> lineOffsets; //< current chunk line offsets in chunkText
+		vector<size_t> lineSizes;  //< current chunk line sizes
+		vector<Key> chunkKeys;     //< current chunk keys, keySpecs.size() per row
+		vector<uint32_t> order;    //< current chunk sorted row order
+
+		vector<string> runPaths;   //< temporary run file paths
+		size_t numRows;            //< number of rows sorted
+};
@@ -0,0 +1,95 @@
+/**
+ *  ofxCsvFormat.cpp
+ *  Inspired and based on Ben Fry's [table class](http://benfry.com/writing/map/Table.pde)
+ *
+ *  The MIT License
+ *
+ *  Copyright (c) 2011-2019 Paul Vollmer, https://paulvollmer.net
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ *
+ *  @modified           2026.10.18
+ *  @version            0.2.1
+ */
+
+#include "ofxCsvFormat.h"
+#include "ofxCsvParse.h"
+
+#include <cmath>
+#include <cstdio>
+
+#ifdef TARGET_WIN32
+	#include <locale.h>
+#elif defined(TARGET_OSX)
+	#include <xlocale.h>
+#else
+	#include <locale.h>
+#endif
+
+/// C locale for snprintf, so '.' is always the decimal mark
+#ifdef TARGET_WIN32
+static _locale_t cLocale() {
+	static _locale_t locale = _create_locale(LC_NUMERIC, "C");
+	return locale;
+}
+#else
+static locale_t cLocale() {
+	static locale_t locale = newlocale(LC_NUMERIC_MASK, "C", (locale_t)0);
+	return locale;
+}
+#endif
+
+/// snprintf a double with a number of significant digits in the C locale
+static size_t formatDouble(char *buf, double v, int digits) {
+#ifdef TARGET_WIN32
+	int n = _snprintf_l(buf, ofxCsvFormat::bufferSize, "%.*g", cLocale(), digits, v);
+#else
+	// there's no portable snprintf_l, so switch this thread's locale
+	locale_t previous = uselocale(cLocale());
+	int n = snprintf(buf, ofxCsvFormat::bufferSize, "%.*g", digits, v);
+	uselocale(previous);
+#endif
+	return n > 0 ? (size_t)n : 0;
+}
+
+//--------------------------------------------------
+size_t ofxCsvFormat::toChars(char *buf, double v) {
+	return formatDouble(buf, v, 6);
+}
+
+//--------------------------------------------------
+size_t ofxCsvFormat::toCharsExact(char *buf, double v) {
+	// the shorter form reads better & is enough for most values
+	size_t n = formatDouble(buf, v, 15);
+	double parsed;
+	if(std::isfinite(v) && (!ofxCsvParse::toDouble(buf, buf + n, parsed) || parsed != v)) {
+		n = formatDouble(buf, v, 17);
+	}
+	return n;
+}
+
+//--------------------------------------------------
+size_t ofxCsvFormat::toCharsExact(char *buf, float v) {
+	size_t n = formatDouble(buf, v, 7);
+	float parsed;
+	if(std::isfinite(v) && (!ofxCsvParse::toFloat(buf, buf + n, parsed) || parsed != v)) {
+		n = formatDouble(buf, v, 9);
+	}
+	return n;
+}
@@ -0,0 +1,207 @@
+/**
+ *  ofxCsvFormat.h
+ *  Inspired and based on Ben Fry's [table class](http://benfry.com/writing/map/Table.pde)
+ *
+ *  The MIT License
+ *
+ *  Copyright (c) 2011-2019 Paul Vollmer, https://paulvollmer.net
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ *
+ *  @modified           2026.10.18
+ *  @version            0.2.1
+ */
+
+#pragma once
+
+#include "ofConstants.h"
+
+#include <type_traits>
+
+/// \namespace ofxCsvFormat
+/// \brief field value formatting without streams or temporary strings
+///
+/// Values are formatted into a small stack buffer & appended straight to
+/// the destination. Output matches ofToString(): floats use 6 significant
+/// digits & a '.' decimal mark, even after setlocale(), & bools are "1" or
+/// "0".
+namespace ofxCsvFormat {
+
+	/// Buffer size required by toChars().
+	static const size_t bufferSize = 32;
+
+	/// Format an unsigned integer.
+	/// \returns number of chars written
+	inline size_t toChars(char *buf, unsigned long long v) {
+		char digits[bufferSize];
+		size_t n = 0;
+		do {
+			digits[n++] = (char)('0' + v % 10);
+			v /= 10;
+		} while(v);
+		for(size_t i = 0; i < n; i++) {
+			buf[i] = digits[n-1-i];
+		}
+		return n;
+	}
+
+	/// Format a signed integer.
+	/// \returns number of chars written
+	inline size_t toChars(char *buf, long long v) {
+		if(v < 0) {
+			buf[0] = '-';
+			// negate as unsigned to handle the most negative value
+			return toChars(buf+1, 0ULL - (unsigned long long)v) + 1;
+		}
+		return toChars(buf, (unsigned long long)v);
+	}
+
+	/// Format a double with 6 significant digits.
+	///
+	/// Always uses a '.' decimal mark, whatever the process locale.
+	///
+	/// \returns number of chars written
+	size_t toChars(char *buf, double v);
+
+	/// Format a bool as "1" or "0".
+	/// \returns number of chars written
+	inline size_t toChars(char *buf, bool v) {
+		buf[0] = v ? '1' : '0';
+		return 1;
+	}
+
+	/// Format a char as itself.
+	/// \returns number of chars written
+	inline size_t toChars(char *buf, char v) {
+		buf[0] = v;
+		return 1;
+	}
+
+	/// Format any other integer type.
+	template<typename T>
+	inline typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value, size_t>::type
+	toChars(char *buf, T v) {
+		return toChars(buf, (long long)v);
+	}
+
+	/// Format any other unsigned integer type.
+	template<typename T>
+	inline typename std::enable_if<std::is_integral<T>::value && std::is_unsigned<T>::value, size_t>::type
+	toChars(char *buf, T v) {
+		return toChars(buf, (unsigned long long)v);
+	}
+
+	/// Format a float with 6 significant digits.
+	inline size_t toChars(char *buf, float v) {
+		return toChars(buf, (double)v);
+	}
+
+	/// Format a double with enough significant digits to parse back to the
+	/// same value: 15 if they do, 17 otherwise.
+	///
+	/// Always uses a '.' decimal mark, whatever the process locale.
+	///
+	/// \returns number of chars written
+	size_t toCharsExact(char *buf, double v);
+
+	/// Format a float with enough significant digits to parse back to the
+	/// same value: 7 if they do, 9 otherwise.
+	///
+	/// Always uses a '.' decimal mark, whatever the process locale.
+	///
+	/// \returns number of chars written
+	size_t toCharsExact(char *buf, float v);
+
+	/// Format an integer, bool, or char, which are always exact.
+	template<typename T>
+	inline typename std::enable_if<std::is_integral<T>::value, size_t>::type
+	toCharsExact(char *buf, T v) {
+		return toChars(buf, v);
+	}
+
+	/// Append a formatted number to a string.
+	template<typename T>
+	inline typename std::enable_if<std::is_arithmetic<T>::value>::type
+	append(string &out, T v) {
+		char buf[bufferSize];
+		out.append(buf, toChars(buf, v));
+	}
+
+	/// Append a string to a string.
+	inline void append(string &out, const string &v) {
+		out.append(v);
+	}
+
+	/// Append a C string to a string.
+	inline void append(string &out, const char *v) {
+		if(v) {
+			out.append(v);
+		}
+	}
+
+	/// Append a number to a string so it parses back to the same value.
+	template<typename T>
+	inline typename std::enable_if<std::is_arithmetic<T>::value>::type
+	appendExact(string &out, T v) {
+		char buf[bufferSize];
+		out.append(buf, toCharsExact(buf, v));
+	}
+
+	/// Append a string to a string.
+	inline void appendExact(string &out, const string &v) {
+		out.append(v);
+	}
+
+	/// Append a C string to a string.
+	inline void appendExact(string &out, const char *v) {
+		append(out, v);
+	}
+
+	/// Append a field value to a row string, optionally double quoted.
+	///
+	/// Quotes inside a quoted field are doubled, ie. a"b -> "a""b".
+	///
+	/// \param exact Format numbers to parse back to the same value, see
+	///              appendExact(), instead of like ofToString()?
+	template<typename T>
+	inline void appendField(string &out, const T &v, bool quote, bool exact=false) {
+		if(!quote) {
+			exact ? appendExact(out, v) : append(out, v);
+			return;
+		}
+		size_t start = out.size();
+		out += '"';
+		exact ? appendExact(out, v) : append(out, v);
+		for(size_t i = start + 1; i < out.size(); i++) {
+			if(out[i] == '"') {
+				out.insert(i, 1, '"');
+				i++;
+			}
+		}
+		out += '"';
+	}
+
+	/// Format a value as a new string.
+	template<typename T>
+	inline string toString(const T &v) {
+		string out;
+		append(out, v);
+		return out;
+	}
+}
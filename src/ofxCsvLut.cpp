@@ -0,0 +1,333 @@
+/**
+ *  ofxCsvLut.cpp
+ *  Inspired and based on Ben Fry's [table class](http://benfry.com/writing/map/Table.pde)
+ *
+ *  The MIT License
+ *
+ *  Copyright (c) 2011-2019 Paul Vollmer, https://paulvollmer.net
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ *
+ *  @modified           2026.10.18
+ *  @version            0.2.1
+ */
+
+#include "ofxCsvLut.h"
+
+#include "ofLog.h"
+
+/// relative tolerance when checking for evenly spaced keys
+static const float s_uniformTolerance = 1e-4f;
+
+//--------------------------------------------------
+ofxCsvLut::ofxCsvLut() {
+	clear();
+}
+
+/// LOADING
+
+//--------------------------------------------------
+bool ofxCsvLut::load1D(const ofxCsv &csv, int keyCol, int valueCol, int firstRow) {
+	vector<float> keys, vals;
+	size_t minCols = max(keyCol, valueCol) + 1;
+	ofxCsvNumberFormat format = csv.getNumberFormat();
+	size_t index = 0;
+	for(auto &row : csv) {
+		if(index >= (size_t)max(firstRow, 0) && row.size() >= minCols) {
+			keys.push_back(row.getFloat(keyCol, format));
+			vals.push_back(row.getFloat(valueCol, format));
+		}
+		index++;
+	}
+	return load1D(keys, vals);
+}
+
+//--------------------------------------------------
+bool ofxCsvLut::load1D(const vector<float> &keys, const vector<float> &vals) {
+	clear();
+	if(keys.size() != vals.size()) {
+		ofLogError("ofxCsvLut") << "Cannot load table: "
+			<< keys.size() << " keys for " << vals.size() << " values";
+		return false;
+	}
+	if(!xAxis.load(keys)) {
+		return false;
+	}
+	values = vals;
+	dimensions = 1;
+	ofLogVerbose("ofxCsvLut") << "Loaded a 1D table of " << keys.size()
+		<< (xAxis.uniform ? " uniform" : " non-uniform") << " keys";
+	return true;
+}
+
+//--------------------------------------------------
+bool ofxCsvLut::load2D(const ofxCsv &csv, int firstRow) {
+	firstRow = max(firstRow, 0);
+	if((size_t)firstRow >= csv.size()) {
+		ofLogError("ofxCsvLut") << "Cannot load table: missing x key row " << firstRow;
+		return false;
+	}
+	vector<float> xKeys, yKeys, vals;
+	ofxCsvNumberFormat format = csv.getNumberFormat();
+	size_t index = 0;
+	for(auto &row : csv) {
+		if(index == (size_t)firstRow) { // x keys
+			for(size_t col = 1; col < row.size(); col++) {
+				xKeys.push_back(row.getFloat(col, format));
+			}
+		}
+		else if(index > (size_t)firstRow && row.size() > xKeys.size()) {
+			yKeys.push_back(row.getFloat(0, format));
+			for(size_t col = 1; col <= xKeys.size(); col++) {
+				vals.push_back(row.getFloat(col, format));
+			}
+		}
+		index++;
+	}
+	return load2D(xKeys, yKeys, vals);
+}
+
+//--------------------------------------------------
+bool ofxCsvLut::load2D(const vector<float> &xKeys, const vector<float> &yKeys, const vector<float> &vals) {
+	clear();
+	if(xKeys.size() * yKeys.size() != vals.size()) {
+		ofLogError("ofxCsvLut") << "Cannot load table: " << vals.size() << " values for a "
+			<< xKeys.size() << "x" << yKeys.size() << " grid";
+		return false;
+	}
+	if(!xAxis.load(xKeys) || !yAxis.load(yKeys)) {
+		clear();
+		return false;
+	}
+	values = vals;
+	dimensions = 2;
+	ofLogVerbose("ofxCsvLut") << "Loaded a " << xKeys.size() << "x" << yKeys.size()
+		<< (isUniform() ? " uniform" : " non-uniform") << " 2D table";
+	return true;
+}
+
+//--------------------------------------------------
+void ofxCsvLut::clear() {
+	dimensions = 0;
+	xAxis = Axis();
+	yAxis = Axis();
+	values.clear();
+}
+
+/// LOOKUP
+
+//--------------------------------------------------
+float ofxCsvLut::lookup(float x) const {
+	if(dimensions != 1) {
+		return 0;
+	}
+	int i;
+	float f;
+	xAxis.locate(x, i, f);
+	return values[i] + f * (values[i+1] - values[i]);
+}
+
+//--------------------------------------------------
+float ofxCsvLut::lookup(float x, float y) const {
+	if(dimensions != 2) {
+		return 0;
+	}
+	int xi, yi;
+	float xf, yf;
+	xAxis.locate(x, xi, xf);
+	yAxis.locate(y, yi, yf);
+	size_t stride = xAxis.keys.size();
+	const float *top = &values[yi * stride + xi];
+	const float *bottom = top + stride;
+	float t = top[0] + xf * (top[1] - top[0]);
+	float b = bottom[0] + xf * (bottom[1] - bottom[0]);
+	return t + yf * (b - t);
+}
+
+//--------------------------------------------------
+void ofxCsvLut::lookup(const float *x, float *out, size_t count) const {
+	if(dimensions != 1) {
+		std::fill(out, out+count, 0.0f);
+		return;
+	}
+	if(!xAxis.uniform) {
+		for(size_t n = 0; n < count; n++) {
+			out[n] = lookup(x[n]);
+		}
+		return;
+	}
+
+	// branch free so the loop can be vectorized
+	const float first = xAxis.keys.front();
+	const float inv = xAxis.invStep;
+	const float last = (float)(xAxis.keys.size()-1);
+	const int maxIndex = (int)xAxis.keys.size()-2;
+	const float *v = values.data();
+	for(size_t n = 0; n < count; n++) {
+		float t = (x[n] - first) * inv;
+		t = t > 0 ? t : 0; // also catches NaN
+		t = t < last ? t : last;
+		int i = (int)t;
+		i = i < maxIndex ? i : maxIndex;
+		float f = t - i;
+		out[n] = v[i] + f * (v[i+1] - v[i]);
+	}
+}
+
+//--------------------------------------------------
+void ofxCsvLut::lookup(const float *x, const float *y, float *out, size_t count) const {
+	if(dimensions != 2) {
+		std::fill(out, out+count, 0.0f);
+		return;
+	}
+	if(!isUniform()) {
+		for(size_t n = 0; n < count; n++) {
+			out[n] = lookup(x[n], y[n]);
+		}
+		return;
+	}
+
+	// branch free so the loop can be vectorized
+	const float xFirst = xAxis.keys.front(), yFirst = yAxis.keys.front();
+	const float xInv = xAxis.invStep, yInv = yAxis.invStep;
+	const float xLast = (float)(xAxis.keys.size()-1), yLast = (float)(yAxis.keys.size()-1);
+	const int xMax = (int)xAxis.keys.size()-2, yMax = (int)yAxis.keys.size()-2;
+	const int stride = (int)xAxis.keys.size();
+	const float *v = values.data();
+	for(size_t n = 0; n < count; n++) {
+		float tx = (x[n] - xFirst) * xInv;
+		float ty = (y[n] - yFirst) * yInv;
+		tx = tx > 0 ? tx : 0;
+		ty = ty > 0 ? ty : 0;
+		tx = tx < xLast ? tx : xLast;
+		ty = ty < yLast ? ty : yLast;
+		int xi = (int)tx, yi = (int)ty;
+		xi = xi < xMax ? xi : xMax;
+		yi = yi < yMax ? yi : yMax;
+		float xf = tx - xi, yf = ty - yi;
+		int i = yi * stride + xi;
+		float t = v[i] + xf * (v[i+1] - v[i]);
+		float b = v[i+stride] + xf * (v[i+stride+1] - v[i+stride]);
+		out[n] = t + yf * (b - t);
+	}
+}
+
+//--------------------------------------------------
+vector<float> ofxCsvLut::lookup(const vector<float> &x) const {
+	vector<float> out(x.size());
+	lookup(x.data(), out.data(), x.size());
+	return out;
+}
+
+/// UTIL
+
+//--------------------------------------------------
+int ofxCsvLut::getDimensions() const {
+	return dimensions;
+}
+
+//--------------------------------------------------
+bool ofxCsvLut::isUniform() const {
+	switch(dimensions) {
+		case 1:
+			return xAxis.uniform;
+		case 2:
+			return xAxis.uniform && yAxis.uniform;
+		default:
+			return false;
+	}
+}
+
+//--------------------------------------------------
+bool ofxCsvLut::empty() const {
+	return dimensions == 0;
+}
+
+// PROTECTED
+
+//--------------------------------------------------
+bool ofxCsvLut::Axis::load(const vector<float> &k) {
+	keys.clear();
+	buckets.clear();
+	uniform = false;
+	invStep = 1;
+	if(k.size() < 2) {
+		ofLogError("ofxCsvLut") << "Cannot load table: need at least 2 keys per axis";
+		return false;
+	}
+	for(size_t i = 1; i < k.size(); i++) {
+		if(!(k[i] > k[i-1])) {
+			ofLogError("ofxCsvLut") << "Cannot load table: keys not strictly ascending at " << i;
+			return false;
+		}
+	}
+	keys = k;
+
+	// evenly spaced?
+	float range = keys.back() - keys.front();
+	float step = range / (keys.size()-1);
+	uniform = true;
+	for(size_t i = 1; i < keys.size()-1; i++) {
+		if(fabs(keys[i] - (keys.front() + i * step)) > step * s_uniformTolerance) {
+			uniform = false;
+			break;
+		}
+	}
+	if(uniform) {
+		invStep = 1.0f / step;
+		return true;
+	}
+
+	// uneven keys: map 2 buckets per key to the last key at or before each
+	// bucket's start so lookups only step forward a few keys
+	size_t numBuckets = keys.size() * 2;
+	invStep = numBuckets / range;
+	buckets.resize(numBuckets);
+	size_t i = 0;
+	for(size_t b = 0; b < numBuckets; b++) {
+		float start = keys.front() + b / invStep;
+		while(i < keys.size()-2 && keys[i+1] <= start) {
+			i++;
+		}
+		buckets[b] = (int)i;
+	}
+	return true;
+}
+
+//--------------------------------------------------
+void ofxCsvLut::Axis::locate(float v, int &index, float &frac) const {
+	int maxIndex = (int)keys.size()-2;
+	if(uniform) {
+		float t = (v - keys.front()) * invStep;
+		t = t > 0 ? t : 0; // also catches NaN
+		t = t < maxIndex+1 ? t : maxIndex+1;
+		index = min((int)t, maxIndex);
+		frac = t - index;
+		return;
+	}
+	float t = (v - keys.front()) * invStep;
+	int b = t > 0 ? (int)min(t, (float)buckets.size()-1) : 0;
+	int i = buckets[b];
+	while(i < maxIndex && keys[i+1] <= v) {
+		i++;
+	}
+	index = i;
+	float f = (v - keys[i]) / (keys[i+1] - keys[i]);
+	frac = f > 0 ? (f < 1 ? f : 1) : 0;
+}
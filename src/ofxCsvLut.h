@@ -0,0 +1,174 @@
+/**
+ *  ofxCsvLut.h
+ *  Inspired and based on Ben Fry's [table class](http://benfry.com/writing/map/Table.pde)
+ *
+ *  The MIT License
+ *
+ *  Copyright (c) 2011-2019 Paul Vollmer, https://paulvollmer.net
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ *
+ *  @modified           2026.10.18
+ *  @version            0.2.1
+ */
+
+#pragma once
+
+#include "ofxCsv.h"
+
+/// \class ofxCsvLut
+/// \brief 1D or 2D interpolated lookup table loaded from ofxCsv cols
+///
+/// Linearly interpolates between keys & clamps to the first & last values
+/// outside the key range, ie. for calibration curves:
+///
+///     ofxCsvLut curve;
+///     curve.load1D(csv, 0, 1, 1); // key & value cols, skip header row
+///     float v = curve.lookup(sensorValue);
+///
+/// 2D tables are loaded from a grid where the first row holds the x keys
+/// & the first col holds the y keys, the top left field is ignored:
+///
+///     ,   0, 0.5,   1
+///     0,  0,  10,  20
+///     1,  5,  15,  25
+///
+/// Notes:
+///   * Keys must be strictly ascending.
+///   * Evenly spaced keys are indexed directly in O(1), uneven keys go
+///     through a small uniform bucket table so lookups stay near O(1).
+///   * The batch lookup functions are branch free for evenly spaced keys
+///     so the compiler can vectorize them.
+///
+class ofxCsvLut {
+
+	public:
+
+		/// Constructor. Initializes and starts the class.
+		ofxCsvLut();
+
+	/// \section Loading
+
+		/// Load a 1D table from key & value cols.
+		///
+		/// Clears any currently loaded data. Rows without the required cols
+		/// are skipped.
+		///
+		/// \param csv Table to load from.
+		/// \param keyCol Key col.
+		/// \param valueCol Value col.
+		/// \param firstRow First row to load, ie. 1 to skip a header row.
+		/// \returns true if the table loaded successfully
+		bool load1D(const ofxCsv &csv, int keyCol, int valueCol, int firstRow=0);
+
+		/// Load a 1D table from keys & values.
+		///
+		/// Clears any currently loaded data.
+		///
+		/// \param keys Strictly ascending keys.
+		/// \param values Values, the same size as keys.
+		/// \returns true if the table loaded successfully
+		bool load1D(const vector<float> &keys, const vector<float> &values);
+
+		/// Load a 2D table from a grid.
+		///
+		/// Clears any currently loaded data.
+		///
+		/// \param csv Table to load from, x keys in the first row & y keys in
+		///            the first col.
+		/// \param firstRow Row holding the x keys.
+		/// \returns true if the table loaded successfully
+		bool load2D(const ofxCsv &csv, int firstRow=0);
+
+		/// Load a 2D table from keys & values.
+		///
+		/// Clears any currently loaded data.
+		///
+		/// \param xKeys Strictly ascending x keys.
+		/// \param yKeys Strictly ascending y keys.
+		/// \param values Values in row major order, size = xKeys * yKeys.
+		/// \returns true if the table loaded successfully
+		bool load2D(const vector<float> &xKeys, const vector<float> &yKeys, const vector<float> &values);
+
+		/// Clear the current table.
+		void clear();
+
+	/// \section Lookup
+
+		/// Interpolated 1D lookup.
+		///
+		/// \returns the value or 0 if not a loaded 1D table
+		float lookup(float x) const;
+
+		/// Bilinearly interpolated 2D lookup.
+		///
+		/// \returns the value or 0 if not a loaded 2D table
+		float lookup(float x, float y) const;
+
+		/// Interpolated 1D lookup of an array of inputs.
+		///
+		/// \param x Input values.
+		/// \param out Output values, may be the same as x.
+		/// \param count Number of values.
+		void lookup(const float *x, float *out, size_t count) const;
+
+		/// Bilinearly interpolated 2D lookup of arrays of inputs.
+		///
+		/// \param x Input x values.
+		/// \param y Input y values.
+		/// \param out Output values, may be the same as x or y.
+		/// \param count Number of values.
+		void lookup(const float *x, const float *y, float *out, size_t count) const;
+
+		/// Interpolated 1D lookup of a vector of inputs.
+		vector<float> lookup(const vector<float> &x) const;
+
+	/// \section Util
+
+		/// Get the number of dimensions: 1, 2, or 0 if not loaded.
+		int getDimensions() const;
+
+		/// Are the keys evenly spaced along all axes?
+		bool isUniform() const;
+
+		/// Is the table empty?
+		bool empty() const;
+
+	protected:
+
+		/// keys along a single axis
+		struct Axis {
+
+			/// set keys & detect even spacing
+			bool load(const vector<float> &keys);
+
+			/// find the key interval & fraction for a value, clamped
+			void locate(float v, int &index, float &frac) const;
+
+			vector<float> keys;  //< strictly ascending keys
+			bool uniform;        //< are the keys evenly spaced?
+			float invStep;       //< 1 / key spacing, or bucket table scale
+			vector<int> buckets; //< first key index per bucket for uneven keys
+		};
+
+		int dimensions;        //< 1, 2, or 0 if not loaded
+		Axis xAxis;            //< x keys
+		Axis yAxis;            //< y keys, 2D only
+		vector<float> values;  //< values, row major for 2D
+};
@@ -0,0 +1,259 @@
+/**
+ *  ofxCsvMapping.h
+ *  Inspired and based on Ben Fry's [table class](http://benfry.com/writing/map/Table.pde)
+ *
+ *  The MIT License
+ *
+ *  Copyright (c) 2011-2019 Paul Vollmer, https://paulvollmer.net
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ *
+ *  @modified           2026.10.18
+ *  @version            0.2.1
+ */
+
+#pragma once
+
+#include "ofxCsvTokenizer.h"
+#include "ofxCsvParse.h"
+#include "ofxCsvFormat.h"
+#include "ofLog.h"
+
+#include <tuple>
+#include <utility>
+
+/// \class ofxCsvMapping
+/// \brief declares which cols the members of a struct are loaded from &
+///        saved to
+///
+/// Specialize for a struct with the OFXCSV_MAPPING macro at global scope,
+/// listing member pointers with either a col name from the header row or a
+/// col index:
+///
+///     struct Sample {
+///         float x, y;
+///         int id;
+///         string label;
+///     };
+///
+///     OFXCSV_MAPPING(Sample,
+///         ofxCsvMember(&Sample::x, "x"),
+///         ofxCsvMember(&Sample::y, "y"),
+///         ofxCsvMember(&Sample::id, 2),
+///         ofxCsvMember(&Sample::label, "label")
+///     )
+///
+/// then load & save with ofxCsv::loadAs() & ofxCsv::saveFrom():
+///
+///     vector<Sample> samples = ofxCsv::loadAs<Sample>("samples.csv");
+///     ofxCsv::saveFrom(samples, "copy.csv");
+///
+/// Each member is parsed straight from the file text by a parser chosen at
+/// compile time from the member type: integers, floating point numbers,
+/// bools, & strings are supported.
+template<typename T>
+struct ofxCsvMapping;
+
+/// Maps a struct member to a col by name or index, see ofxCsvMember().
+template<typename T, typename M>
+struct ofxCsvMemberMapping {
+	M T::*member; //< member pointer
+	string name;  //< col name in the header row, empty when using an index
+	int col;      //< col index, -1 when using a name
+};
+
+/// Map a struct member to the col with the given name in the header row.
+template<typename T, typename M>
+ofxCsvMemberMapping<T, M> ofxCsvMember(M T::*member, const string &name) {
+	return ofxCsvMemberMapping<T, M>{member, name, -1};
+}
+
+/// Map a struct member to the col at the given index.
+template<typename T, typename M>
+ofxCsvMemberMapping<T, M> ofxCsvMember(M T::*member, int col) {
+	return ofxCsvMemberMapping<T, M>{member, "", col};
+}
+
+/// Declare the col mapping for a struct, see ofxCsvMapping.
+#define OFXCSV_MAPPING(Type, ...) \
+	template<> \
+	struct ofxCsvMapping<Type> { \
+		static auto members() -> decltype(std::make_tuple(__VA_ARGS__)) { \
+			return std::make_tuple(__VA_ARGS__); \
+		} \
+	};
+
+/// \namespace ofxCsvMappingDetail
+/// \brief implementation of ofxCsv::loadAs() & ofxCsv::saveFrom()
+namespace ofxCsvMappingDetail {
+
+	/// call f(element, index) for each tuple element
+	template<typename Tuple, typename F, size_t... I>
+	void forEach(Tuple &tuple, F &&f, std::index_sequence<I...>) {
+		int unpack[] = {0, (f(std::get<I>(tuple), I), 0)...};
+		(void)unpack;
+	}
+	template<typename Tuple, typename F>
+	void forEach(Tuple &tuple, F &&f) {
+		forEach(tuple, f, std::make_index_sequence<std::tuple_size<Tuple>::value>());
+	}
+
+	/// parse a field into a string member
+	inline void parse(const ofxCsvFieldView &field, string &out, const ofxCsvNumberFormat &) {
+		field.str(out);
+	}
+
+	/// parse a field into a bool member
+	inline void parse(const ofxCsvFieldView &field, bool &out, const ofxCsvNumberFormat &) {
+		if(field.quoted) {
+			string s = field.str();
+			ofxCsvParse::toBool(s.data(), s.data() + s.size(), out);
+			return;
+		}
+		ofxCsvParse::toBool(field.data, field.data + field.size, out);
+	}
+
+	/// parse a field into an integer member, clamped to its range
+	template<typename M>
+	typename std::enable_if<std::is_integral<M>::value>::type
+	parse(const ofxCsvFieldView &field, M &out, const ofxCsvNumberFormat &format) {
+		if(field.quoted) {
+			string s = field.str();
+			ofxCsvParse::toInteger(s.data(), s.data() + s.size(), out, nullptr, format);
+		}
+		else {
+			ofxCsvParse::toInteger(field.data, field.data + field.size, out, nullptr, format);
+		}
+	}
+
+	/// parse a field into a floating point member
+	template<typename M>
+	typename std::enable_if<std::is_floating_point<M>::value>::type
+	parse(const ofxCsvFieldView &field, M &out, const ofxCsvNumberFormat &format) {
+		double v = 0;
+		if(field.quoted) {
+			string s = field.str();
+			ofxCsvParse::toDouble(s.data(), s.data() + s.size(), v, format);
+		}
+		else {
+			ofxCsvParse::toDouble(field.data, field.data + field.size, v, format);
+		}
+		out = (M)v;
+	}
+
+	/// resolve the col index for each member, looking up names in the
+	/// header fields if given
+	/// \returns false if a name could not be resolved
+	template<typename T>
+	bool resolveCols(const vector<ofxCsvFieldView> *header, vector<int> &cols) {
+		auto members = ofxCsvMapping<T>::members();
+		cols.assign(std::tuple_size<decltype(members)>::value, -1);
+		bool resolved = true;
+		forEach(members, [&](const auto &member, size_t i) {
+			if(member.col >= 0 || member.name.empty()) {
+				cols[i] = member.col;
+				return;
+			}
+			if(header) {
+				for(size_t col = 0; col < header->size(); col++) {
+					if((*header)[col].str() == member.name) {
+						cols[i] = (int)col;
+						return;
+					}
+				}
+			}
+			ofLogError("ofxCsv") << "Cannot map member: col \"" << member.name << "\" not found";
+			resolved = false;
+		});
+		return resolved;
+	}
+
+	/// parse fields into a struct
+	template<typename T, typename Members>
+	void parseRow(const Members &members, const vector<ofxCsvFieldView> &fields, const vector<int> &cols,
+	              const ofxCsvNumberFormat &format, T &out) {
+		forEach(members, [&](const auto &member, size_t i) {
+			if(cols[i] >= 0 && (size_t)cols[i] < fields.size()) {
+				parse(fields[cols[i]], out.*(member.member), format);
+			}
+		});
+	}
+
+	/// col index for each member when saving, members with a name fill
+	/// the cols not taken by members with an index in order
+	template<typename T>
+	vector<int> saveCols() {
+		auto members = ofxCsvMapping<T>::members();
+		vector<int> cols(std::tuple_size<decltype(members)>::value, -1);
+		vector<bool> taken;
+		forEach(members, [&](const auto &member, size_t i) {
+			if(member.col >= 0) {
+				cols[i] = member.col;
+				if(taken.size() <= (size_t)member.col) {
+					taken.resize(member.col + 1, false);
+				}
+				taken[member.col] = true;
+			}
+		});
+		int next = 0;
+		forEach(members, [&](const auto &member, size_t i) {
+			if(cols[i] < 0) {
+				while((size_t)next < taken.size() && taken[next]) {
+					next++;
+				}
+				cols[i] = next++;
+			}
+		});
+		return cols;
+	}
+
+	/// append the header row string for a struct
+	template<typename Members>
+	void formatHeader(string &out, const Members &members, const vector<int> &cols, bool quote, const string &separator) {
+		int numCols = cols.empty() ? 0 : *std::max_element(cols.begin(), cols.end()) + 1;
+		for(int col = 0; col < numCols; col++) {
+			if(col > 0) {
+				out += separator;
+			}
+			forEach(members, [&](const auto &member, size_t i) {
+				if(cols[i] == col) {
+					ofxCsvFormat::appendField(out, member.name, quote);
+				}
+			});
+		}
+		out += '\n';
+	}
+
+	/// append the row string for a struct
+	template<typename T, typename Members>
+	void formatRow(string &out, const Members &members, const T &in, const vector<int> &cols, bool quote, const string &separator) {
+		int numCols = cols.empty() ? 0 : *std::max_element(cols.begin(), cols.end()) + 1;
+		for(int col = 0; col < numCols; col++) {
+			if(col > 0) {
+				out += separator;
+			}
+			forEach(members, [&](const auto &member, size_t i) {
+				if(cols[i] == col) {
+					ofxCsvFormat::appendField(out, in.*(member.member), quote, true);
+				}
+			});
+		}
+		out += '\n';
+	}
+}
@@ -0,0 +1,664 @@
+/**
+ *  ofxCsvPagedTable.cpp
+ *  Inspired and based on Ben Fry's [table class](http://benfry.com/writing/map/Table.pde)
+ *
+ *  The MIT License
+ *
+ *  Copyright (c) 2011-2019 Paul Vollmer, https://paulvollmer.net
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ *
+ *  @modified           2026.10.18
+ *  @version            0.2.1
+ */
+
+#include "ofxCsvPagedTable.h"
+
+#include "ofLog.h"
+#include "ofUtils.h"
+#include "ofFileUtils.h"
+
+#include <cstring>
+#include <cmath>
+#include <sys/stat.h>
+
+/// initial index read buffer size, grows to fit long lines
+static const size_t s_bufferSize = 1 << 20;
+
+/// small string size which doesn't allocate, libstdc++ & libc++ keep at least 15 chars
+static const size_t s_smallString = 15;
+
+/// Bloom filter sidecar file id & version
+static const char s_bloomMagic[8] = {'O', 'F', 'X', 'C', 'S', 'V', 'B', 'F'};
+static const uint32_t s_bloomVersion = 2;
+
+/// 64 bit FNV-1a hash of a key, with a final mix so the bits used by the
+/// filter are well distributed
+static inline uint64_t hashKey(const char *data, size_t size) {
+	uint64_t h = 14695981039346656037ULL;
+	for(size_t i = 0; i < size; i++) {
+		h = (h ^ (unsigned char)data[i]) * 1099511628211ULL;
+	}
+	h ^= h >> 33;
+	h *= 0xff51afd7ed558ccdULL;
+	h ^= h >> 33;
+	h *= 0xc4ceb9fe1a85ec53ULL;
+	h ^= h >> 33;
+	return h;
+}
+
+/// add bytes to a running content hash, 8 bytes at a time as it covers the
+/// whole file while indexing
+static inline uint64_t hashBytes(uint64_t h, const char *data, size_t size) {
+	const uint64_t prime = 0x9e3779b97f4a7c15ULL;
+	size_t i = 0;
+	for(; i + 8 <= size; i += 8) {
+		uint64_t word;
+		memcpy(&word, data + i, 8);
+		h = (h ^ word) * prime;
+		h ^= h >> 29;
+	}
+	uint64_t tail = size;
+	for(; i < size; i++) {
+		tail = (tail << 8) | (unsigned char)data[i];
+	}
+	h = (h ^ tail) * prime;
+	return h ^ (h >> 29);
+}
+
+/// get a file's modification time in seconds, 0 if unknown
+static int64_t getFileTime(const string &path) {
+#ifdef TARGET_WIN32
+	struct _stat64 info;
+	if(_stat64(path.c_str(), &info) != 0) {
+		return 0;
+	}
+#else
+	struct stat info;
+	if(stat(path.c_str(), &info) != 0) {
+		return 0;
+	}
+#endif
+	return (int64_t)info.st_mtime;
+}
+
+/// get the i-th filter bit for a hash, Kirsch & Mitzenmacher double hashing
+static inline uint64_t bloomBit(uint64_t hash, unsigned int i, uint64_t numBits) {
+	uint64_t h1 = hash & 0xFFFFFFFF, h2 = (hash >> 32) | 1;
+	return (h1 + i * h2) % numBits;
+}
+
+// 64 bit file seeking
+#ifdef TARGET_WIN32
+	#define ofxCsvSeek _fseeki64
+#else
+	#define ofxCsvSeek fseeko
+#endif
+
+//--------------------------------------------------
+ofxCsvPagedTable::ofxCsvPagedTable() {
+	commentPrefix = "#";
+	rowsPerBlock = 4096;
+	numRows = 0;
+	fileTime = 0;
+	memoryBudget = 64 * 1024 * 1024;
+	memoryUsage = 0;
+	prefetchBlocks = 2;
+	lastBlock = (size_t)-1;
+}
+
+//--------------------------------------------------
+ofxCsvPagedTable::~ofxCsvPagedTable() {
+	close();
+}
+
+/// SETUP
+
+//--------------------------------------------------
+void ofxCsvPagedTable::setMemoryBudget(size_t bytes) {
+	memoryBudget = bytes;
+	trim();
+}
+
+//--------------------------------------------------
+void ofxCsvPagedTable::setPrefetch(size_t blocks) {
+	prefetchBlocks = blocks;
+}
+
+/// FILE IO
+
+//--------------------------------------------------
+bool ofxCsvPagedTable::open(const string &path, const string &separator, const string &comment, size_t rowsPerBlock) {
+
+	close();
+	tokenizer.setSeparator(separator);
+	commentPrefix = comment;
+	this->rowsPerBlock = max(rowsPerBlock, (size_t)1);
+
+	// do some checks
+	ofFile info(ofToDataPath(path), ofFile::Reference);
+	if(!info.exists()) {
+		ofLogError("ofxCsvPagedTable") << "Cannot open " << path << ": file not found";
+		return false;
+	}
+	if(info.isDirectory()) {
+		ofLogError("ofxCsvPagedTable") << "Cannot open " << path << ": \"file\" is actually a directory";
+		return false;
+	}
+	FILE *file = fopen(info.getAbsolutePath().c_str(), "rb");
+	if(!file) {
+		ofLogError("ofxCsvPagedTable") << "Cannot open " << path << ": file not readable";
+		return false;
+	}
+	fileTime = getFileTime(info.getAbsolutePath());
+
+	// find the line starts without parsing, noting the start & content hash
+	// of every block
+	vector<char> buffer(s_bufferSize);
+	size_t filled = 0;
+	uint64_t bufferOffset = 0;
+	bool eof = false;
+	while(true) {
+		if(!eof) {
+			size_t read = fread(buffer.data() + filled, 1, buffer.size() - filled, file);
+			filled += read;
+			eof = (read == 0);
+		}
+		const char *begin = buffer.data();
+		const char *end = begin + filled;
+		const char *start = begin;
+		while(start < end) {
+			const char *newline = (const char *)memchr(start, '\n', end - start);
+			if(!newline && !eof) {
+				break; // incomplete line, read more
+			}
+			const char *lineEnd = newline ? newline : end;
+			if(lineEnd > start && *(lineEnd-1) == '\r') {
+				lineEnd--;
+			}
+			size_t lineSize = lineEnd - start;
+			bool isComment = !commentPrefix.empty() && lineSize >= commentPrefix.size() &&
+			                 memcmp(start, commentPrefix.data(), commentPrefix.size()) == 0;
+			if(lineSize > 0 && !isComment) {
+				if(numRows % this->rowsPerBlock == 0) {
+					blockOffsets.push_back(bufferOffset + (start - begin));
+					blockHashes.push_back(0);
+				}
+				numRows++;
+			}
+			if(!blockHashes.empty()) {
+				const char *next = newline ? newline + 1 : end;
+				blockHashes.back() = hashBytes(blockHashes.back(), start, next - start);
+			}
+			start = newline ? newline + 1 : end;
+		}
+
+		// keep any partial line for the next read
+		size_t consumed = start - begin;
+		memmove(buffer.data(), buffer.data() + consumed, filled - consumed);
+		filled -= consumed;
+		bufferOffset += consumed;
+		if(eof && filled == 0) {
+			break;
+		}
+		if(filled == buffer.size()) {
+			buffer.resize(buffer.size() * 2);
+		}
+	}
+	bool error = ferror(file) != 0;
+	fclose(file);
+	if(error) {
+		ofLogError("ofxCsvPagedTable") << "Cannot open " << path << ": couldn't read";
+		close();
+		return false;
+	}
+	blockOffsets.push_back(bufferOffset);
+	filePath = info.getAbsolutePath();
+
+	ofLogVerbose("ofxCsvPagedTable") << "Indexed " << numRows << " rows in "
+	                                 << getNumBlocks() << " blocks from " << path;
+	return true;
+}
+
+//--------------------------------------------------
+void ofxCsvPagedTable::close() {
+	pending.clear(); // waits for any background parsing
+	clearCache();
+	bloomFilters.clear();
+	blockOffsets.clear();
+	blockHashes.clear();
+	filePath = "";
+	numRows = 0;
+	fileTime = 0;
+}
+
+//--------------------------------------------------
+bool ofxCsvPagedTable::isOpen() const {
+	return !blockOffsets.empty();
+}
+
+/// ROW ACCESS
+
+//--------------------------------------------------
+unsigned int ofxCsvPagedTable::getNumRows() const {
+	return numRows;
+}
+
+//--------------------------------------------------
+unsigned int ofxCsvPagedTable::getNumCols(int row) {
+	if(row > -1 && (size_t)row < numRows) {
+		return getRow(row).size();
+	}
+	return 0;
+}
+
+//--------------------------------------------------
+const ofxCsvRow& ofxCsvPagedTable::getRow(size_t index) {
+	if(index >= numRows) {
+		return emptyRow;
+	}
+	size_t number = index / rowsPerBlock;
+	const Block *block = getBlock(number);
+	if(number != lastBlock) {
+		if(number == lastBlock + 1) { // sequential, read ahead
+			prefetch(number);
+		}
+		lastBlock = number;
+	}
+	size_t row = index % rowsPerBlock;
+	if(!block || row >= block->rows.size()) {
+		return emptyRow;
+	}
+	return block->rows[row];
+}
+
+//--------------------------------------------------
+const ofxCsvRow& ofxCsvPagedTable::operator[](size_t index) {
+	return getRow(index);
+}
+
+//--------------------------------------------------
+size_t ofxCsvPagedTable::size() const {
+	return numRows;
+}
+
+//--------------------------------------------------
+bool ofxCsvPagedTable::empty() const {
+	return numRows == 0;
+}
+
+/// KEY LOOKUPS
+
+//--------------------------------------------------
+size_t ofxCsvPagedTable::findRows(int col, const string &key, vector<size_t> &rows) {
+	rows.clear();
+	if(col < 0) {
+		return 0;
+	}
+	auto found = bloomFilters.find(col);
+	const BloomFilter *filter = (found != bloomFilters.end()) ? &found->second : nullptr;
+	uint64_t hash = hashKey(key.data(), key.size());
+	for(size_t b = 0; b < getNumBlocks(); b++) {
+		if(filter && !mayContain(*filter, b, hash)) {
+			continue;
+		}
+		const Block *block = getBlock(b);
+		if(!block) {
+			continue;
+		}
+		for(size_t i = 0; i < block->rows.size(); i++) {
+			const ofxCsvRow &row = block->rows[i];
+			if((size_t)col < row.size() && *(row.begin() + col) == key) {
+				rows.push_back(b * rowsPerBlock + i);
+			}
+		}
+	}
+	return rows.size();
+}
+
+//--------------------------------------------------
+bool ofxCsvPagedTable::addBloomFilter(int col, float falsePositiveRate) {
+	if(!isOpen() || col < 0) {
+		ofLogError("ofxCsvPagedTable") << "Cannot add Bloom filter for col " << col << ": no file open";
+		return false;
+	}
+
+	// optimal size for rowsPerBlock keys: m = -n ln(p) / ln(2)^2, k = m/n ln(2)
+	double p = min(max((double)falsePositiveRate, 1e-6), 0.5);
+	double bitsPerKey = -log(p) / (log(2.0) * log(2.0));
+	BloomFilter filter;
+	filter.wordsPerBlock = max<size_t>(1, (size_t)ceil(bitsPerKey * rowsPerBlock / 64));
+	filter.hashes = max(1, (int)round(bitsPerKey * log(2.0)));
+	filter.bits.assign(filter.wordsPerBlock * getNumBlocks(), 0);
+
+	// read blocks directly so building doesn't flush the cache
+	uint64_t numBits = filter.wordsPerBlock * 64;
+	for(size_t b = 0; b < getNumBlocks(); b++) {
+		BlockPtr block = loadBlock(b);
+		if(!block) {
+			return false;
+		}
+		uint64_t *bits = filter.bits.data() + b * filter.wordsPerBlock;
+		for(auto &row : block->rows) {
+			if((size_t)col >= row.size()) {
+				continue;
+			}
+			const string &field = *(row.begin() + col);
+			uint64_t hash = hashKey(field.data(), field.size());
+			for(unsigned int i = 0; i < filter.hashes; i++) {
+				uint64_t bit = bloomBit(hash, i, numBits);
+				bits[bit / 64] |= 1ULL << (bit % 64);
+			}
+		}
+	}
+	bloomFilters[col] = std::move(filter);
+
+	ofLogVerbose("ofxCsvPagedTable") << "Built Bloom filter for col " << col << " over "
+	                                 << getNumBlocks() << " blocks";
+	return true;
+}
+
+//--------------------------------------------------
+bool ofxCsvPagedTable::hasBloomFilter(int col) const {
+	return bloomFilters.find(col) != bloomFilters.end();
+}
+
+//--------------------------------------------------
+void ofxCsvPagedTable::clearBloomFilters() {
+	bloomFilters.clear();
+}
+
+//--------------------------------------------------
+bool ofxCsvPagedTable::saveBloomFilters(const string &path) const {
+	string sidecar = path.empty() ? filePath + ".bloom" : ofToDataPath(path);
+	if(!isOpen()) {
+		ofLogError("ofxCsvPagedTable") << "Cannot save Bloom filters to " << sidecar << ": no file open";
+		return false;
+	}
+	FILE *file = fopen(sidecar.c_str(), "wb");
+	if(!file) {
+		ofLogError("ofxCsvPagedTable") << "Cannot save Bloom filters to " << sidecar << ": file not writable";
+		return false;
+	}
+
+	// header: id, version, & table layout & contents to check against when loading
+	uint64_t layout[6] = {blockOffsets.back(), rowsPerBlock, getNumBlocks(), getLayoutHash(),
+	                      (uint64_t)fileTime, getContentHash()};
+	uint32_t count = bloomFilters.size();
+	bool written = fwrite(s_bloomMagic, 1, sizeof(s_bloomMagic), file) == sizeof(s_bloomMagic) &&
+	               fwrite(&s_bloomVersion, sizeof(s_bloomVersion), 1, file) == 1 &&
+	               fwrite(layout, sizeof(layout), 1, file) == 1 &&
+	               fwrite(&count, sizeof(count), 1, file) == 1;
+	for(auto &entry : bloomFilters) {
+		const BloomFilter &filter = entry.second;
+		int32_t col = entry.first;
+		uint32_t hashes = filter.hashes;
+		uint64_t words = filter.wordsPerBlock;
+		written = written &&
+		          fwrite(&col, sizeof(col), 1, file) == 1 &&
+		          fwrite(&hashes, sizeof(hashes), 1, file) == 1 &&
+		          fwrite(&words, sizeof(words), 1, file) == 1 &&
+		          fwrite(filter.bits.data(), sizeof(uint64_t), filter.bits.size(), file) == filter.bits.size();
+	}
+	written = (fclose(file) == 0) && written;
+	if(!written) {
+		ofLogError("ofxCsvPagedTable") << "Cannot save Bloom filters to " << sidecar << ": couldn't write";
+		return false;
+	}
+	return true;
+}
+
+//--------------------------------------------------
+bool ofxCsvPagedTable::loadBloomFilters(const string &path) {
+	string sidecar = path.empty() ? filePath + ".bloom" : ofToDataPath(path);
+	if(!isOpen()) {
+		ofLogError("ofxCsvPagedTable") << "Cannot load Bloom filters from " << sidecar << ": no file open";
+		return false;
+	}
+	FILE *file = fopen(sidecar.c_str(), "rb");
+	if(!file) {
+		ofLogVerbose("ofxCsvPagedTable") << "No Bloom filters in " << sidecar;
+		return false;
+	}
+
+	// check the header matches this table
+	char magic[sizeof(s_bloomMagic)];
+	uint32_t version = 0, count = 0;
+	uint64_t layout[6];
+	uint64_t expected[6] = {blockOffsets.back(), rowsPerBlock, getNumBlocks(), getLayoutHash(),
+	                        (uint64_t)fileTime, getContentHash()};
+	bool read = fread(magic, 1, sizeof(magic), file) == sizeof(magic) &&
+	            fread(&version, sizeof(version), 1, file) == 1 &&
+	            fread(layout, sizeof(layout), 1, file) == 1 &&
+	            fread(&count, sizeof(count), 1, file) == 1;
+	if(!read || memcmp(magic, s_bloomMagic, sizeof(magic)) != 0 || version != s_bloomVersion) {
+		ofLogError("ofxCsvPagedTable") << "Cannot load Bloom filters from " << sidecar << ": not a Bloom filter file";
+		fclose(file);
+		return false;
+	}
+	if(memcmp(layout, expected, sizeof(layout)) != 0) {
+		ofLogWarning("ofxCsvPagedTable") << "Ignoring Bloom filters in " << sidecar << ": out of date";
+		fclose(file);
+		return false;
+	}
+
+	std::map<int, BloomFilter> filters;
+	for(uint32_t i = 0; i < count && read; i++) {
+		int32_t col = 0;
+		uint32_t hashes = 0;
+		uint64_t words = 0;
+		read = fread(&col, sizeof(col), 1, file) == 1 &&
+		       fread(&hashes, sizeof(hashes), 1, file) == 1 &&
+		       fread(&words, sizeof(words), 1, file) == 1 &&
+		       words > 0 && words < (1ULL << 32) && hashes > 0 && hashes < 64;
+		if(read) {
+			BloomFilter &filter = filters[col];
+			filter.hashes = hashes;
+			filter.wordsPerBlock = words;
+			filter.bits.resize(words * getNumBlocks());
+			read = fread(filter.bits.data(), sizeof(uint64_t), filter.bits.size(), file) == filter.bits.size();
+		}
+	}
+	fclose(file);
+	if(!read) {
+		ofLogError("ofxCsvPagedTable") << "Cannot load Bloom filters from " << sidecar << ": couldn't read";
+		return false;
+	}
+	bloomFilters = std::move(filters);
+
+	ofLogVerbose("ofxCsvPagedTable") << "Loaded " << count << " Bloom filters from " << sidecar;
+	return true;
+}
+
+/// UTIL
+
+//--------------------------------------------------
+size_t ofxCsvPagedTable::getNumBlocks() const {
+	return blockOffsets.empty() ? 0 : blockOffsets.size() - 1;
+}
+
+//--------------------------------------------------
+size_t ofxCsvPagedTable::getNumCachedBlocks() const {
+	return cache.size();
+}
+
+//--------------------------------------------------
+size_t ofxCsvPagedTable::getMemoryUsage() const {
+	return memoryUsage;
+}
+
+//--------------------------------------------------
+void ofxCsvPagedTable::clearCache() {
+	cache.clear();
+	cacheIndex.clear();
+	memoryUsage = 0;
+	lastBlock = (size_t)-1;
+}
+
+//--------------------------------------------------
+string ofxCsvPagedTable::getPath() const {
+	return filePath;
+}
+
+//--------------------------------------------------
+string ofxCsvPagedTable::getSeparator() const {
+	return tokenizer.getSeparator();
+}
+
+//--------------------------------------------------
+string ofxCsvPagedTable::getComment() const {
+	return commentPrefix;
+}
+
+// PROTECTED
+
+//--------------------------------------------------
+ofxCsvPagedTable::BlockPtr ofxCsvPagedTable::loadBlock(size_t index) const {
+
+	// read the block text, each call uses its own file so blocks can be
+	// loaded from several threads
+	uint64_t start = blockOffsets[index];
+	size_t size = blockOffsets[index+1] - start;
+	string text(size, '\0');
+	FILE *file = fopen(filePath.c_str(), "rb");
+	if(!file) {
+		ofLogError("ofxCsvPagedTable") << "Cannot read block " << index << ": file not readable";
+		return nullptr;
+	}
+	bool read = ofxCsvSeek(file, start, SEEK_SET) == 0 &&
+	            fread(&text[0], 1, size, file) == size;
+	fclose(file);
+	if(!read) {
+		ofLogError("ofxCsvPagedTable") << "Cannot read block " << index << ": couldn't read";
+		return nullptr;
+	}
+
+	// parse rows, skipping empty & comment lines like the index
+	BlockPtr block = std::make_shared<Block>();
+	block->rows.reserve(rowsPerBlock);
+	vector<ofxCsvFieldView> fields;
+	const char *end = text.data() + text.size();
+	const char *lineEnd = nullptr;
+	for(const char *line = text.data(), *next = line; line < end; line = next) {
+		next = ofxCsvTokenizer::nextLine(line, end, lineEnd);
+		size_t lineSize = lineEnd - line;
+		if(lineSize == 0 || (!commentPrefix.empty() && lineSize >= commentPrefix.size() &&
+		   memcmp(line, commentPrefix.data(), commentPrefix.size()) == 0)) {
+			continue;
+		}
+		tokenizer.split(line, lineSize, fields);
+		block->rows.push_back(ofxCsvRow());
+		vector<string> &cols = block->rows.back().getData();
+		cols.resize(fields.size());
+		for(size_t i = 0; i < fields.size(); i++) {
+			fields[i].str(cols[i]);
+		}
+	}
+
+	// estimate memory use: row & field objects plus any string heap storage
+	block->bytes = sizeof(Block) + block->rows.capacity() * sizeof(ofxCsvRow);
+	for(auto &row : block->rows) {
+		block->bytes += row.size() * sizeof(string);
+		for(auto &col : row) {
+			if(col.capacity() > s_smallString) {
+				block->bytes += col.capacity() + 1;
+			}
+		}
+	}
+	return block;
+}
+
+//--------------------------------------------------
+const ofxCsvPagedTable::Block* ofxCsvPagedTable::getBlock(size_t index) {
+
+	// cached? move to front
+	auto found = cacheIndex.find(index);
+	if(found != cacheIndex.end()) {
+		cache.splice(cache.begin(), cache, found->second);
+		return cache.front().second.get();
+	}
+
+	// prefetched or read now
+	BlockPtr block;
+	auto queued = pending.find(index);
+	if(queued != pending.end()) {
+		block = queued->second.get();
+		pending.erase(queued);
+	}
+	else {
+		block = loadBlock(index);
+	}
+	if(!block) {
+		return nullptr;
+	}
+	cache.emplace_front(index, block);
+	cacheIndex[index] = cache.begin();
+	memoryUsage += block->bytes;
+	trim();
+	return block.get();
+}
+
+//--------------------------------------------------
+void ofxCsvPagedTable::prefetch(size_t index) {
+
+	// drop read aheads which were passed by, ie. after a jump
+	while(!pending.empty() && pending.begin()->first < index) {
+		pending.erase(pending.begin());
+	}
+
+	size_t numBlocks = getNumBlocks();
+	for(size_t next = index + 1; next <= index + prefetchBlocks && next < numBlocks; next++) {
+		if(cacheIndex.count(next) || pending.count(next)) {
+			continue;
+		}
+		pending[next] = std::async(std::launch::async, &ofxCsvPagedTable::loadBlock, this, next);
+	}
+}
+
+//--------------------------------------------------
+void ofxCsvPagedTable::trim() {
+	while(memoryUsage > memoryBudget && cache.size() > 1) {
+		memoryUsage -= cache.back().second->bytes;
+		cacheIndex.erase(cache.back().first);
+		cache.pop_back();
+	}
+}
+
+//--------------------------------------------------
+bool ofxCsvPagedTable::mayContain(const BloomFilter &filter, size_t block, uint64_t hash) const {
+	const uint64_t *bits = filter.bits.data() + block * filter.wordsPerBlock;
+	uint64_t numBits = filter.wordsPerBlock * 64;
+	for(unsigned int i = 0; i < filter.hashes; i++) {
+		uint64_t bit = bloomBit(hash, i, numBits);
+		if(!(bits[bit / 64] & (1ULL << (bit % 64)))) {
+			return false;
+		}
+	}
+	return true;
+}
+
+//--------------------------------------------------
+uint64_t ofxCsvPagedTable::getLayoutHash() const {
+	return hashKey((const char *)blockOffsets.data(), blockOffsets.size() * sizeof(uint64_t));
+}
+
+//--------------------------------------------------
+uint64_t ofxCsvPagedTable::getContentHash() const {
+	return hashKey((const char *)blockHashes.data(), blockHashes.size() * sizeof(uint64_t));
+}
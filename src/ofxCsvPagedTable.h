@@ -0,0 +1,281 @@
+/**
+ *  ofxCsvPagedTable.h
+ *  Inspired and based on Ben Fry's [table class](http://benfry.com/writing/map/Table.pde)
+ *
+ *  The MIT License
+ *
+ *  Copyright (c) 2011-2019 Paul Vollmer, https://paulvollmer.net
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ *
+ *  @modified           2026.10.18
+ *  @version            0.2.1
+ */
+
+#pragma once
+
+#include "ofxCsvRow.h"
+#include "ofxCsvTokenizer.h"
+
+#include <list>
+#include <map>
+#include <memory>
+#include <future>
+#include <unordered_map>
+
+/// \class ofxCsvPagedTable
+/// \brief read only table for CSV files larger than memory
+///
+/// Opening a file only builds an index of where each block of rows starts.
+/// Blocks are parsed when first accessed & kept in a least recently used
+/// cache which stays within a memory budget, so getRow() & operator[] work
+/// like ofxCsv on files of any size:
+///
+///     ofxCsvPagedTable table;
+///     table.setMemoryBudget(256 * 1024 * 1024); // 256 MB
+///     table.open("huge.csv");
+///     for(size_t i = 0; i < table.getNumRows(); i++) {
+///         float v = table[i].getFloat(2);
+///     }
+///
+/// When rows are accessed in order, the following blocks are parsed ahead
+/// on background threads.
+///
+/// Returned rows stay valid until the next getRow() call which loads a
+/// different block, as that may evict the row's block from the cache.
+/// Follows the same parsing rules as ofxCsv::load().
+///
+/// Point lookups on a key col can skip most blocks without reading them
+/// using per block Bloom filters, which are saved to a sidecar file so they
+/// are only built once:
+///
+///     if(!table.loadBloomFilters()) { // "huge.csv.bloom"
+///         table.addBloomFilter(0);
+///         table.saveBloomFilters();
+///     }
+///     vector<size_t> rows;
+///     table.findRows(0, "id-12345", rows);
+///
+class ofxCsvPagedTable {
+
+	public:
+
+		/// Constructor. Initializes and starts the class.
+		ofxCsvPagedTable();
+
+		/// Destructor. Waits for any pending background parsing.
+		virtual ~ofxCsvPagedTable();
+
+	/// \section Setup
+
+		/// Set the cache memory budget in bytes, default 64 MB.
+		///
+		/// The most recently accessed block is always kept, even if it alone
+		/// is larger than the budget.
+		void setMemoryBudget(size_t bytes);
+
+		/// Set the number of blocks to parse ahead on sequential access,
+		/// default 2, 0 to disable.
+		void setPrefetch(size_t blocks);
+
+	/// \section File IO
+
+		/// Open a CSV file & index its row blocks.
+		///
+		/// Reads the whole file once to find the row block offsets, without
+		/// parsing the rows. Skips empty lines & lines beginning with the
+		/// comment prefix.
+		///
+		/// \param path File path to open.
+		/// \param separator Field separator string, default comma ",".
+		/// \param comment Comment line prefix string, default "#".
+		/// \param rowsPerBlock Number of rows per cached block, default 4096.
+		/// \returns true if the file was opened & indexed successfully
+		bool open(const string &path, const string &separator=",",
+		          const string &comment="#", size_t rowsPerBlock=4096);
+
+		/// Close the file & clear the index & cache.
+		void close();
+
+		/// Is a file currently open?
+		bool isOpen() const;
+
+	/// \section Row Access
+
+		/// Get the number of rows.
+		unsigned int getNumRows() const;
+
+		/// Get the number of cols for a given row.
+		///
+		/// \param row Row to get the number of cols for, default 0.
+		/// \returns the number of cols in the given row or 0 if the row does
+		///          not exist.
+		unsigned int getNumCols(int row=0);
+
+		/// Get a row at a given position.
+		///
+		/// Parses the row's block if it's not cached.
+		///
+		/// \param index Row position.
+		/// \returns row, an empty row if the index is out of range or the
+		///          block couldn't be read
+		const ofxCsvRow& getRow(size_t index);
+
+		/// Raw row access via row array indices.
+		const ofxCsvRow& operator[](size_t index);
+
+		/// Alternate row size getter.
+		size_t size() const;
+
+		/// Is the table empty?
+		/// \returns true if there are no rows.
+		bool empty() const;
+
+	/// \section Key Lookups
+
+		/// Find the rows whose field in a col matches a key exactly.
+		///
+		/// Only reads blocks whose Bloom filter for the col may contain the
+		/// key, or every block if the col has no filter.
+		///
+		/// \param col Column number.
+		/// \param key Field text to match, without quotes.
+		/// \param rows Cleared & set to the matching row indices in order.
+		/// \returns the number of matching rows
+		size_t findRows(int col, const string &key, vector<size_t> &rows);
+
+		/// Build a Bloom filter per block for a col's field values.
+		///
+		/// Reads & parses the whole file once. Filters are sized for every
+		/// row in a block being a distinct key, about 10 bits per row at the
+		/// default 1% false positive rate.
+		///
+		/// \param col Column number.
+		/// \param falsePositiveRate Chance a block is read without containing
+		///                          the key, default 0.01.
+		/// \returns true if the filter was built
+		bool addBloomFilter(int col, float falsePositiveRate=0.01f);
+
+		/// Does a col have a Bloom filter?
+		bool hasBloomFilter(int col) const;
+
+		/// Remove all Bloom filters.
+		void clearBloomFilters();
+
+		/// Save the Bloom filters to a sidecar file.
+		///
+		/// \param path File path, default "" for the table path + ".bloom".
+		/// \returns true if the file was saved successfully
+		bool saveBloomFilters(const string &path="") const;
+
+		/// Load Bloom filters from a sidecar file, replacing any current
+		/// filters.
+		///
+		/// The file is checked against the table's size, block layout,
+		/// modification time, & per block content hashes so filters for an
+		/// older version of the file aren't used, even if a key was edited in
+		/// place without changing the file size. The format uses native byte
+		/// order.
+		///
+		/// \param path File path, default "" for the table path + ".bloom".
+		/// \returns true if the filters were loaded & match the table
+		bool loadBloomFilters(const string &path="");
+
+	/// \section Util
+
+		/// Get the number of row blocks in the index.
+		size_t getNumBlocks() const;
+
+		/// Get the number of cached row blocks.
+		size_t getNumCachedBlocks() const;
+
+		/// Get the estimated memory used by the cached row blocks in bytes.
+		size_t getMemoryUsage() const;
+
+		/// Clear the cached row blocks, keeping the index.
+		void clearCache();
+
+		/// Get the current file path.
+		string getPath() const;
+
+		/// Get the field separator, default comma ",".
+		string getSeparator() const;
+
+		/// Get the current comment line prefix, default "#".
+		string getComment() const;
+
+	protected:
+
+		/// parsed row block
+		struct Block {
+			vector<ofxCsvRow> rows; //< parsed rows
+			size_t bytes;           //< estimated memory use
+		};
+		typedef std::shared_ptr<Block> BlockPtr;
+
+		/// cached blocks, most recently used first
+		typedef std::list<std::pair<size_t, BlockPtr>> BlockList;
+
+		/// read & parse a block, safe to call from a background thread
+		BlockPtr loadBlock(size_t index) const;
+
+		/// get a block from the cache, the prefetch queue, or the file
+		const Block* getBlock(size_t index);
+
+		/// start parsing the blocks following a given block
+		void prefetch(size_t index);
+
+		/// evict least recently used blocks until within the memory budget
+		void trim();
+
+		/// Bloom filters for a col, 1 per block
+		struct BloomFilter {
+			unsigned int hashes;   //< number of hash functions
+			size_t wordsPerBlock;  //< filter size per block in 64 bit words
+			vector<uint64_t> bits; //< filter bits for all blocks
+		};
+
+		/// may a block's filter contain a key hash?
+		bool mayContain(const BloomFilter &filter, size_t block, uint64_t hash) const;
+
+		/// hash of the block layout, to check sidecar files
+		uint64_t getLayoutHash() const;
+
+		/// hash of the block contents, to check sidecar files
+		uint64_t getContentHash() const;
+
+		string filePath;                 //< current file path, absolute
+		string commentPrefix;            //< comment line prefix, default: "#"
+		ofxCsvTokenizer tokenizer;       //< field tokenizer
+		size_t rowsPerBlock;             //< number of rows per block
+		size_t numRows;                  //< total number of rows
+		vector<uint64_t> blockOffsets;   //< block start byte offsets + end of file
+		vector<uint64_t> blockHashes;    //< block content hashes
+		int64_t fileTime;                //< file modification time when opened
+
+		size_t memoryBudget;             //< cache budget in bytes
+		size_t memoryUsage;              //< estimated cache memory use in bytes
+		size_t prefetchBlocks;           //< number of blocks to parse ahead
+		size_t lastBlock;                //< last accessed block, for sequential access
+		BlockList cache;                 //< cached blocks, most recent first
+		std::unordered_map<size_t, BlockList::iterator> cacheIndex; //< cache lookup
+		std::map<size_t, std::future<BlockPtr>> pending; //< blocks being prefetched
+		ofxCsvRow emptyRow;              //< returned for out of range rows
+		std::map<int, BloomFilter> bloomFilters; //< Bloom filters by col
+};
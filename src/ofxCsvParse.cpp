@@ -0,0 +1,519 @@
+/**
+ *  ofxCsvParse.cpp
+ *  Inspired and based on Ben Fry's [table class](http://benfry.com/writing/map/Table.pde)
+ *
+ *  The MIT License
+ *
+ *  Copyright (c) 2011-2019 Paul Vollmer, https://paulvollmer.net
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ *
+ *  @modified           2026.10.18
+ *  @version            0.2.1
+ */
+
+#include "ofxCsvParse.h"
+
+#include <cstring>
+#include <cerrno>
+#include <climits>
+#include <limits>
+#include <type_traits>
+
+#ifdef TARGET_WIN32
+	#include <locale.h>
+#elif defined(TARGET_OSX)
+	#include <xlocale.h>
+#else
+	#include <locale.h>
+#endif
+
+// 8 digits at a time needs little endian loads
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	#define OFXCSV_SWAR 0
+#else
+	#define OFXCSV_SWAR 1
+#endif
+
+/// max number of chars copied for the C library fallback
+static const size_t s_maxChars = 128;
+
+/// exactly representable powers of ten
+static const double s_powersOfTen[] = {
+	1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+	1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+/// decimal number split into its parts
+struct Decimal {
+	uint64_t mantissa;  //< significant digits
+	int64_t exponent;   //< power of ten
+	bool negative;      //< leading '-'?
+	bool truncated;     //< more than 19 significant digits?
+	const char *begin;  //< start of the number text, after whitespace
+	const char *end;    //< end of the number text
+};
+
+/// skip leading whitespace
+static inline const char* skipSpace(const char *begin, const char *end) {
+	while(begin < end && isspace((unsigned char)*begin)) {
+		begin++;
+	}
+	return begin;
+}
+
+/// is a char a decimal digit?
+static inline bool isDigit(char c) {
+	return (unsigned char)(c - '0') < 10;
+}
+
+#if OFXCSV_SWAR
+/// are 8 loaded chars all digits?
+static inline bool isEightDigits(uint64_t chars) {
+	return !(((chars + 0x4646464646464646ULL) | (chars - 0x3030303030303030ULL)) & 0x8080808080808080ULL);
+}
+
+/// convert 8 loaded digit chars to their value with 3 multiplications
+static inline uint32_t parseEightDigits(uint64_t chars) {
+	chars -= 0x3030303030303030ULL;
+	chars = (chars * 10) + (chars >> 8); // pairs
+	chars = (((chars & 0x000000FF000000FFULL) * 0x000F424000000064ULL) +
+	         (((chars >> 16) & 0x000000FF000000FFULL) * 0x0000271000000001ULL)) >> 32;
+	return (uint32_t)chars;
+}
+#endif
+
+/// accumulate digits into a mantissa, skipping single digit group
+/// separators between digits, ie. 1,234,567
+/// \returns number of digits read
+static inline size_t readDigits(const char *&p, const char *end, uint64_t &mantissa, char separator='\0') {
+	size_t count = 0;
+	while(true) {
+#if OFXCSV_SWAR
+		while(end - p >= 8) {
+			uint64_t chars;
+			memcpy(&chars, p, 8);
+			if(!isEightDigits(chars)) {
+				break;
+			}
+			mantissa = mantissa * 100000000 + parseEightDigits(chars);
+			p += 8;
+			count += 8;
+		}
+#endif
+		while(p < end && isDigit(*p)) {
+			mantissa = mantissa * 10 + (*p - '0');
+			p++;
+			count++;
+		}
+		if(separator != '\0' && count > 0 && end - p >= 2 && *p == separator && isDigit(p[1])) {
+			p++;
+			continue;
+		}
+		return count;
+	}
+}
+
+/// get a hex digit's value
+/// \returns 0-15, or 16 if the char isn't a hex digit
+static inline unsigned int hexValue(char c) {
+	unsigned int digit = (unsigned char)(c - '0');
+	unsigned int letter = (unsigned char)((c | 0x20) - 'a');
+	return (digit < 10) ? digit : ((letter < 6) ? letter + 10 : 16);
+}
+
+/// read an unsigned integer: decimal, "0x" hex, or "0b" binary digits
+/// \param overflow Set to true if the value doesn't fit 64 bits.
+/// \returns false if there are no digits
+static bool readMagnitude(const char *&p, const char *end, uint64_t &out, bool &overflow, char separator) {
+	overflow = false;
+	if(p == end || !isDigit(*p)) {
+		return false;
+	}
+
+	// prefixed hex & binary, up to 16 & 64 significant digits fit
+	if(end - p >= 3 && p[0] == '0') {
+		char prefix = p[1] | 0x20;
+		if(prefix == 'x' && hexValue(p[2]) < 16) {
+			p += 2;
+			while(p < end && *p == '0') {
+				p++;
+			}
+			uint64_t v = 0;
+			size_t count = 0;
+			unsigned int digit;
+			while(p < end && (digit = hexValue(*p)) < 16) {
+				v = (v << 4) | digit;
+				p++;
+				count++;
+			}
+			out = v;
+			overflow = count > 16;
+			return true;
+		}
+		if(prefix == 'b' && (unsigned char)(p[2] - '0') < 2) {
+			p += 2;
+			while(p < end && *p == '0') {
+				p++;
+			}
+			uint64_t v = 0;
+			size_t count = 0;
+			while(p < end && (unsigned char)(*p - '0') < 2) {
+				v = (v << 1) | (uint64_t)(*p - '0');
+				p++;
+				count++;
+			}
+			out = v;
+			overflow = count > 64;
+			return true;
+		}
+	}
+
+	// decimal, up to 19 digits always fit & 20 might
+	while(p < end && *p == '0') {
+		p++;
+	}
+	const char *digits = p;
+	uint64_t v = 0;
+	size_t count = readDigits(p, end, v, separator);
+	if(count == 20) { // the sum wrapped if the leading 19 digits are too big
+		uint64_t leading = 0;
+		const char *c = digits;
+		for(size_t n = 0; n < 19; c++) {
+			if(isDigit(*c)) {
+				leading = leading * 10 + (*c - '0');
+				n++;
+			}
+		}
+		while(!isDigit(*c)) { // group separator
+			c++;
+		}
+		overflow = leading > (UINT64_MAX - (uint64_t)(*c - '0')) / 10;
+	}
+	else {
+		overflow = count > 20;
+	}
+	out = v;
+	return true;
+}
+
+/// split a decimal number: [+-]digits[.digits][(e|E)[+-]digits]
+/// \returns false if there are no digits
+static bool parseDecimal(const char *begin, const char *end, Decimal &d, const ofxCsvNumberFormat &format) {
+	const char *p = skipSpace(begin, end);
+	d.begin = p;
+	d.mantissa = 0;
+	d.exponent = 0;
+	d.negative = false;
+	d.truncated = false;
+	if(p < end && (*p == '-' || *p == '+')) {
+		d.negative = (*p == '-');
+		p++;
+	}
+
+	// integer part, leading zeros aren't significant
+	bool digits = false;
+	while(p < end && *p == '0') {
+		p++;
+		digits = true;
+	}
+	size_t significant = readDigits(p, end, d.mantissa, format.thousandsSeparator);
+	digits = digits || significant > 0;
+
+	// fraction part
+	if(p < end && *p == format.decimalMark) {
+		p++;
+		const char *fraction = p;
+		if(d.mantissa == 0) {
+			while(p < end && *p == '0') {
+				p++;
+			}
+		}
+		size_t count = readDigits(p, end, d.mantissa);
+		significant += count;
+		d.exponent -= (p - fraction);
+		digits = digits || p > fraction;
+	}
+	if(!digits) {
+		d.end = begin;
+		return false;
+	}
+
+	// exponent, only if followed by digits
+	if(p < end && (*p == 'e' || *p == 'E')) {
+		const char *e = p + 1;
+		bool negative = false;
+		if(e < end && (*e == '-' || *e == '+')) {
+			negative = (*e == '-');
+			e++;
+		}
+		if(e < end && isDigit(*e)) {
+			int64_t exponent = 0;
+			while(e < end && isDigit(*e)) {
+				if(exponent < 100000) { // far beyond any double
+					exponent = exponent * 10 + (*e - '0');
+				}
+				e++;
+			}
+			d.exponent += negative ? -exponent : exponent;
+			p = e;
+		}
+	}
+	d.truncated = significant > 19;
+	d.end = p;
+	return true;
+}
+
+/// C locale for the C library fallback, so '.' is always the decimal point
+#ifdef TARGET_WIN32
+static _locale_t cLocale() {
+	static _locale_t locale = _create_locale(LC_NUMERIC, "C");
+	return locale;
+}
+#else
+static locale_t cLocale() {
+	static locale_t locale = newlocale(LC_NUMERIC_MASK, "C", (locale_t)0);
+	return locale;
+}
+#endif
+
+/// exactly rounded conversion of a parsed number by the C library
+template<typename T>
+static T slowConvert(const Decimal &d, const ofxCsvNumberFormat &format) {
+	char buf[s_maxChars];
+	size_t size = 0;
+	if(format.isDefault()) {
+		size = min((size_t)(d.end - d.begin), s_maxChars-1);
+		memcpy(buf, d.begin, size);
+	}
+	else { // the C library only knows "1234.5"
+		for(const char *c = d.begin; c < d.end && size < s_maxChars-1; c++) {
+			if(*c == format.decimalMark) {
+				buf[size++] = '.';
+			}
+			else if(*c != format.thousandsSeparator) {
+				buf[size++] = *c;
+			}
+		}
+	}
+	buf[size] = '\0';
+#ifdef TARGET_WIN32
+	return std::is_same<T, float>::value ? _strtof_l(buf, nullptr, cLocale()) : _strtod_l(buf, nullptr, cLocale());
+#else
+	return std::is_same<T, float>::value ? strtof_l(buf, nullptr, cLocale()) : strtod_l(buf, nullptr, cLocale());
+#endif
+}
+
+/// convert a parsed number to a double
+/// \returns false if the value couldn't be computed exactly
+static inline bool fastConvert(const Decimal &d, double &out) {
+	if(d.truncated) {
+		return false;
+	}
+	if(d.mantissa == 0) {
+		out = d.negative ? -0.0 : 0.0;
+		return true;
+	}
+
+	// Clinger's fast path: mantissa & power of ten are both exact doubles, so
+	// a single multiply or divide is exactly rounded
+	const uint64_t maxMantissa = 1ULL << 53;
+	uint64_t mantissa = d.mantissa;
+	int64_t exponent = d.exponent;
+	if(mantissa > maxMantissa) {
+		return false;
+	}
+	if(exponent > 22) { // move extra powers of ten into the mantissa, ie. 12e30
+		while(exponent > 22 && mantissa <= maxMantissa / 10) {
+			mantissa *= 10;
+			exponent--;
+		}
+		if(exponent > 22) {
+			return false;
+		}
+	}
+	if(exponent < -22) {
+		return false;
+	}
+	double v = (double)mantissa;
+	v = exponent < 0 ? v / s_powersOfTen[-exponent] : v * s_powersOfTen[exponent];
+	out = d.negative ? -v : v;
+	return true;
+}
+
+/// case insensitive prefix check, word is lowercase
+static bool startsWithWord(const char *buf, size_t size, const char *word) {
+	size_t len = strlen(word);
+	if(size < len) {
+		return false;
+	}
+	for(size_t i = 0; i < len; i++) {
+		if(tolower((unsigned char)buf[i]) != word[i]) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/// parse "inf", "infinity", or "nan" with an optional sign, like strtod()
+static bool parseSpecial(const char *begin, const char *end, double &out) {
+	const char *p = skipSpace(begin, end);
+	bool negative = false;
+	if(p < end && (*p == '-' || *p == '+')) {
+		negative = (*p == '-');
+		p++;
+	}
+	if(startsWithWord(p, end - p, "inf")) {
+		out = negative ? -HUGE_VAL : HUGE_VAL;
+		return true;
+	}
+	if(startsWithWord(p, end - p, "nan")) {
+		out = negative ? -NAN : NAN;
+		return true;
+	}
+	return false;
+}
+
+//--------------------------------------------------
+template<typename T>
+bool ofxCsvParse::toInteger(const char *begin, const char *end, T &out, bool *overflow,
+                            const ofxCsvNumberFormat &format) {
+	const char *p = skipSpace(begin, end);
+	bool negative = false;
+	if(p < end && (*p == '-' || *p == '+')) {
+		negative = (*p == '-');
+		p++;
+	}
+	uint64_t v = 0;
+	bool over = false;
+	if(!readMagnitude(p, end, v, over, format.thousandsSeparator)) {
+		out = 0;
+		if(overflow) {
+			*overflow = false;
+		}
+		return false;
+	}
+
+	// saturate to the type's range
+	const uint64_t max = (uint64_t)std::numeric_limits<T>::max();
+	if(std::is_signed<T>::value) {
+		over = over || v > (negative ? max + 1 : max);
+		if(over) {
+			out = negative ? std::numeric_limits<T>::min() : std::numeric_limits<T>::max();
+		}
+		else {
+			out = negative ? (T)(int64_t)(0 - v) : (T)v;
+		}
+	}
+	else {
+		over = over || v > max || (negative && v != 0);
+		if(over) {
+			out = negative ? 0 : std::numeric_limits<T>::max();
+		}
+		else {
+			out = (T)v;
+		}
+	}
+	if(overflow) {
+		*overflow = over;
+	}
+	return true;
+}
+
+// instantiate for the standard integer types, which the fixed width types
+// are aliases of
+#define OFXCSV_INTEGER(T) \
+	template bool ofxCsvParse::toInteger<T>(const char *begin, const char *end, T &out, \
+	                                        bool *overflow, const ofxCsvNumberFormat &format);
+OFXCSV_INTEGER(char)
+OFXCSV_INTEGER(signed char)
+OFXCSV_INTEGER(unsigned char)
+OFXCSV_INTEGER(short)
+OFXCSV_INTEGER(unsigned short)
+OFXCSV_INTEGER(int)
+OFXCSV_INTEGER(unsigned int)
+OFXCSV_INTEGER(long)
+OFXCSV_INTEGER(unsigned long)
+OFXCSV_INTEGER(long long)
+OFXCSV_INTEGER(unsigned long long)
+#undef OFXCSV_INTEGER
+
+//--------------------------------------------------
+bool ofxCsvParse::toInt64(const char *begin, const char *end, int64_t &out, const ofxCsvNumberFormat &format) {
+	return toInteger<int64_t>(begin, end, out, nullptr, format);
+}
+
+//--------------------------------------------------
+bool ofxCsvParse::toDouble(const char *begin, const char *end, double &out, const ofxCsvNumberFormat &format) {
+	Decimal d;
+	if(!parseDecimal(begin, end, d, format)) {
+		if(parseSpecial(begin, end, out)) {
+			return true;
+		}
+		out = 0;
+		return false;
+	}
+	if(!fastConvert(d, out)) {
+		out = slowConvert<double>(d, format);
+	}
+	return true;
+}
+
+//--------------------------------------------------
+bool ofxCsvParse::toFloat(const char *begin, const char *end, float &out, const ofxCsvNumberFormat &format) {
+	Decimal d;
+	if(!parseDecimal(begin, end, d, format)) {
+		double special = 0;
+		bool parsed = parseSpecial(begin, end, special);
+		out = (float)special;
+		return parsed;
+	}
+
+	// rounding the exactly rounded double to float is only wrong when the
+	// double lands exactly halfway between two floats, ie. when its 29 low
+	// mantissa bits are 1 followed by zeros
+	double v = 0;
+	if(fastConvert(d, v)) {
+		uint64_t bits;
+		memcpy(&bits, &v, sizeof(bits));
+		if((bits & 0x1FFFFFFFULL) != 0x10000000ULL) {
+			out = (float)v;
+			return true;
+		}
+	}
+	out = slowConvert<float>(d, format);
+	return true;
+}
+
+//--------------------------------------------------
+bool ofxCsvParse::toBool(const char *begin, const char *end, bool &out) {
+	const char *p = skipSpace(begin, end);
+	if(startsWithWord(p, end - p, "true")) {
+		out = true;
+		return true;
+	}
+	if(startsWithWord(p, end - p, "false")) {
+		out = false;
+		return true;
+	}
+	double v = 0;
+	bool parsed = toDouble(p, end, v);
+	out = v != 0;
+	return parsed;
+}
@@ -0,0 +1,101 @@
+/**
+ *  ofxCsvParse.h
+ *  Inspired and based on Ben Fry's [table class](http://benfry.com/writing/map/Table.pde)
+ *
+ *  The MIT License
+ *
+ *  Copyright (c) 2011-2019 Paul Vollmer, https://paulvollmer.net
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ *
+ *  @modified           2026.10.18
+ *  @version            0.2.1
+ */
+
+#pragma once
+
+#include "ofConstants.h"
+
+/// \class ofxCsvNumberFormat
+/// \brief decimal mark & thousands separator used when parsing numbers
+///
+/// The default is "1234.5", ie. for files with ';' separators & ','
+/// decimals use:
+///
+///     ofxCsvNumberFormat format(',', '.'); // "1.234,5"
+///
+struct ofxCsvNumberFormat {
+
+	char decimalMark;        //< decimal mark, default '.'
+	char thousandsSeparator; //< digit group separator, default '\0' for none
+
+	ofxCsvNumberFormat(char decimalMark='.', char thousandsSeparator='\0') :
+		decimalMark(decimalMark), thousandsSeparator(thousandsSeparator) {}
+
+	/// Is this the default format?
+	bool isDefault() const {return decimalMark == '.' && thousandsSeparator == '\0';}
+};
+
+/// \namespace ofxCsvParse
+/// \brief field value parsing from char ranges without temporary strings
+///
+/// Like ofToInt(), ofToFloat(), etc: leading whitespace is skipped, parsing
+/// stops at the first char which doesn't fit the value & the value is 0 or
+/// false if nothing could be parsed.
+///
+/// Numbers use a '.' decimal mark by default, or the mark & thousands
+/// separator of an ofxCsvNumberFormat, whatever the process locale.
+/// Floating point values are exactly rounded: most are computed directly
+/// from up to 19 significant digits, reading 8 digits at a time, & only
+/// long or extreme values fall back to the C library.
+namespace ofxCsvParse {
+
+	/// Parse an integer of any standard width, ie. int8_t - int64_t or
+	/// uint8_t - uint64_t, saturating to the type's range on overflow.
+	///
+	/// Reads decimal digits, or hex & binary digits after a "0x" or "0b"
+	/// prefix, ie. "0x11120119". Prefixed values are read as numbers, so
+	/// "0xFF" is 255 & overflows an int8_t. Decimal digits are read 8 at a
+	/// time.
+	///
+	/// \param overflow Optional, set to true if the value was out of range.
+	/// \returns true if a value was parsed
+	template<typename T>
+	bool toInteger(const char *begin, const char *end, T &out, bool *overflow=nullptr,
+	               const ofxCsvNumberFormat &format=ofxCsvNumberFormat());
+
+	/// Parse a 64 bit integer, saturating on overflow, see toInteger().
+	/// \returns true if a value was parsed
+	bool toInt64(const char *begin, const char *end, int64_t &out,
+	             const ofxCsvNumberFormat &format=ofxCsvNumberFormat());
+
+	/// Parse a double.
+	/// \returns true if a value was parsed
+	bool toDouble(const char *begin, const char *end, double &out,
+	              const ofxCsvNumberFormat &format=ofxCsvNumberFormat());
+
+	/// Parse a float.
+	/// \returns true if a value was parsed
+	bool toFloat(const char *begin, const char *end, float &out,
+	             const ofxCsvNumberFormat &format=ofxCsvNumberFormat());
+
+	/// Parse a bool: "true", "false", or a number, case insensitive.
+	/// \returns true if a value was parsed
+	bool toBool(const char *begin, const char *end, bool &out);
+}
@@ -0,0 +1,266 @@
+/**
+ *  ofxCsvPipeline.cpp
+ *  Inspired and based on Ben Fry's [table class](http://benfry.com/writing/map/Table.pde)
+ *
+ *  The MIT License
+ *
+ *  Copyright (c) 2011-2019 Paul Vollmer, https://paulvollmer.net
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ *
+ *  @modified           2026.10.18
+ *  @version            0.2.1
+ */
+
+#include "ofxCsvPipeline.h"
+
+#include "ofLog.h"
+#include "ofFileUtils.h"
+
+/// output file flush size
+static const size_t s_flushSize = 64 * 1024;
+
+//--------------------------------------------------
+ofxCsvPipeline::ofxCsvPipeline() {
+	passHeader = false;
+	headerDone = false;
+	done = false;
+}
+
+//--------------------------------------------------
+ofxCsvPipeline::ofxCsvPipeline(const string &path, const string &separator, const string &comment) : ofxCsvPipeline() {
+	open(path, separator, comment);
+}
+
+//--------------------------------------------------
+ofxCsvPipeline::ofxCsvPipeline(ofxCsvReader &&reader) : ofxCsvPipeline() {
+	this->reader = std::move(reader);
+}
+
+//--------------------------------------------------
+bool ofxCsvPipeline::open(const string &path, const string &separator, const string &comment) {
+	stages.clear();
+	passHeader = false;
+	headerDone = false;
+	done = false;
+	return reader.open(path, separator, comment);
+}
+
+/// STAGES
+
+//--------------------------------------------------
+ofxCsvPipeline& ofxCsvPipeline::header(bool pass) {
+	passHeader = pass;
+	return *this;
+}
+
+//--------------------------------------------------
+ofxCsvPipeline& ofxCsvPipeline::filter(Filter filter) {
+	Stage stage = {Stage::FILTER, filter, nullptr, 0, 0};
+	return addStage(stage);
+}
+
+//--------------------------------------------------
+ofxCsvPipeline& ofxCsvPipeline::transform(Transform transform) {
+	Stage stage = {Stage::TRANSFORM, nullptr, transform, 0, 0};
+	return addStage(stage);
+}
+
+//--------------------------------------------------
+ofxCsvPipeline& ofxCsvPipeline::skip(size_t n) {
+	Stage stage = {Stage::SKIP, nullptr, nullptr, n, 0};
+	return addStage(stage);
+}
+
+//--------------------------------------------------
+ofxCsvPipeline& ofxCsvPipeline::take(size_t n) {
+	Stage stage = {Stage::TAKE, nullptr, nullptr, n, 0};
+	return addStage(stage);
+}
+
+/// SINKS
+
+//--------------------------------------------------
+bool ofxCsvPipeline::toFile(const string &path, bool quote, const string &separator) {
+
+	// do some checks
+	ofFile file(ofToDataPath(path), ofFile::Reference);
+	if(!file.exists()) {
+		ofFile create(ofToDataPath(path), ofFile::WriteOnly, false);
+		if(!create.create()) {
+			ofLogError("ofxCsvPipeline") << "Could not save to " << path << ": couldn't create";
+			return false;
+		}
+	}
+	if(file.isDirectory()) {
+		ofLogError("ofxCsvPipeline") << "Cannot save " << path << ": \"file\" is actually a directory";
+		return false;
+	}
+	FILE *out = fopen(file.getAbsolutePath().c_str(), "wb");
+	if(!out) {
+		ofLogError("ofxCsvPipeline") << "Cannot save " << path << ": file not writable";
+		return false;
+	}
+
+	// format rows into a bounded buffer, flushing as it fills
+	string buffer;
+	buffer.reserve(s_flushSize * 2);
+	bool written = true;
+	size_t lineCount = 0;
+	while(next()) {
+		bool first = true;
+		for(auto &field : row) {
+			if(!first) {
+				buffer += separator;
+			}
+			ofxCsvFormat::appendField(buffer, field, quote);
+			first = false;
+		}
+		buffer += '\n';
+		lineCount++;
+		if(buffer.size() >= s_flushSize) {
+			written = written && fwrite(buffer.data(), 1, buffer.size(), out) == buffer.size();
+			buffer.clear();
+		}
+	}
+	written = written && fwrite(buffer.data(), 1, buffer.size(), out) == buffer.size();
+	written = (fclose(out) == 0) && written;
+	if(!written) {
+		ofLogError("ofxCsvPipeline") << "Could not save to " << path << ": couldn't write";
+		return false;
+	}
+
+	ofLogVerbose("ofxCsvPipeline") << "Wrote " << lineCount << " lines to " << path;
+	return true;
+}
+
+//--------------------------------------------------
+size_t ofxCsvPipeline::toTable(ofxCsv &csv) {
+	csv.clear();
+	while(next()) {
+		csv.addRow(row);
+	}
+	return csv.getNumRows();
+}
+
+//--------------------------------------------------
+ofxCsv ofxCsvPipeline::toTable() {
+	ofxCsv csv;
+	toTable(csv);
+	return csv;
+}
+
+//--------------------------------------------------
+size_t ofxCsvPipeline::forEach(std::function<void(const ofxCsvRow &row)> func) {
+	size_t n = 0;
+	while(next()) {
+		func(row);
+		n++;
+	}
+	return n;
+}
+
+//--------------------------------------------------
+size_t ofxCsvPipeline::count() {
+	size_t n = 0;
+	while(next()) {
+		n++;
+	}
+	return n;
+}
+
+/// ITERATION
+
+//--------------------------------------------------
+bool ofxCsvPipeline::next() {
+	while(!done && reader.next()) {
+
+		// copy fields into the current row, reusing its string storage
+		const ofxCsvRowView &view = reader.getRow();
+		vector<string> &fields = row.getData();
+		fields.resize(view.size());
+		for(size_t i = 0; i < view.size(); i++) {
+			view[i].str(fields[i]);
+		}
+
+		if(!headerDone) {
+			headerDone = true;
+			if(passHeader) {
+				return true;
+			}
+		}
+
+		bool keep = true;
+		for(auto &stage : stages) {
+			switch(stage.type) {
+				case Stage::FILTER:
+					keep = stage.filter(row);
+					break;
+				case Stage::TRANSFORM:
+					stage.transform(row);
+					break;
+				case Stage::SKIP:
+					if(stage.seen < stage.count) {
+						stage.seen++;
+						keep = false;
+					}
+					break;
+				case Stage::TAKE:
+					if(stage.seen >= stage.count) {
+						keep = false;
+						done = true;
+					}
+					else if(++stage.seen == stage.count) {
+						done = true; // this row is the last that can pass
+					}
+					break;
+			}
+			if(!keep) {
+				break;
+			}
+		}
+		if(keep) {
+			return true;
+		}
+	}
+	return false;
+}
+
+//--------------------------------------------------
+const ofxCsvRow& ofxCsvPipeline::getRow() const {
+	return row;
+}
+
+//--------------------------------------------------
+ofxCsvPipeline::iterator ofxCsvPipeline::begin() {
+	return next() ? iterator(this) : iterator();
+}
+
+//--------------------------------------------------
+ofxCsvPipeline::iterator ofxCsvPipeline::end() {
+	return iterator();
+}
+
+// PROTECTED
+
+//--------------------------------------------------
+ofxCsvPipeline& ofxCsvPipeline::addStage(const Stage &stage) {
+	stages.push_back(stage);
+	return *this;
+}
@@ -0,0 +1,203 @@
+/**
+ *  ofxCsvPipeline.h
+ *  Inspired and based on Ben Fry's [table class](http://benfry.com/writing/map/Table.pde)
+ *
+ *  The MIT License
+ *
+ *  Copyright (c) 2011-2019 Paul Vollmer, https://paulvollmer.net
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ *
+ *  @modified           2026.10.18
+ *  @version            0.2.1
+ */
+
+#pragma once
+
+#include "ofxCsv.h"
+
+/// \class ofxCsvPipeline
+/// \brief lazy row pipeline from a CSV file to a file, table, or loop
+///
+/// Stages run row by row in a single streaming pass over the input, so
+/// memory use stays bounded by a single row no matter how big the input is:
+///
+///     ofxCsvPipeline("in.csv")
+///         .header()
+///         .filter([](const ofxCsvRow &row) {return row.getFloat(2) > 0;})
+///         .transform([](ofxCsvRow &row) {row.addFloat(row.getFloat(2) * 2);})
+///         .take(1000)
+///         .toFile("out.csv");
+///
+/// Stages run in the order they are added. take() stops reading the input
+/// as soon as enough rows have passed it.
+///
+/// A pipeline can also be looped over directly & its iterators, like
+/// ofxCsvReader's, are plain input iterators so they can be used with
+/// standard algorithms or range adaptors.
+///
+/// Pipelines are single pass: once a sink has run, the input is consumed.
+class ofxCsvPipeline {
+
+	public:
+
+		/// Filter function, return true to keep a row.
+		typedef std::function<bool(const ofxCsvRow &row)> Filter;
+
+		/// Transform function, modifies a row in place.
+		typedef std::function<void(ofxCsvRow &row)> Transform;
+
+		/// Input iterator over the pipeline output rows.
+		class iterator {
+			public:
+				typedef std::input_iterator_tag iterator_category;
+				typedef ofxCsvRow value_type;
+				typedef std::ptrdiff_t difference_type;
+				typedef const ofxCsvRow* pointer;
+				typedef const ofxCsvRow& reference;
+
+				iterator() : pipeline(nullptr) {}
+				explicit iterator(ofxCsvPipeline *pipeline) : pipeline(pipeline) {}
+
+				reference operator*() const {return pipeline->getRow();}
+				pointer operator->() const {return &pipeline->getRow();}
+				iterator& operator++() {
+					if(!pipeline->next()) {
+						pipeline = nullptr;
+					}
+					return *this;
+				}
+				void operator++(int) {++(*this);}
+				bool operator==(const iterator &i) const {return pipeline == i.pipeline;}
+				bool operator!=(const iterator &i) const {return pipeline != i.pipeline;}
+
+			private:
+				ofxCsvPipeline *pipeline; //< pipeline or nullptr at the end
+		};
+
+		/// Constructor, set the input with open().
+		ofxCsvPipeline();
+
+		/// Create & open an input CSV file.
+		///
+		/// \param path File path to read.
+		/// \param separator Field separator string, default comma ",".
+		/// \param comment Comment line prefix string, default "#".
+		ofxCsvPipeline(const string &path, const string &separator=",", const string &comment="#");
+
+		/// Create from an open reader, ie. ofxCsv::rows().
+		ofxCsvPipeline(ofxCsvReader &&reader);
+
+		/// Open an input CSV file.
+		///
+		/// Clears any current stages.
+		///
+		/// \param path File path to read.
+		/// \param separator Field separator string, default comma ",".
+		/// \param comment Comment line prefix string, default "#".
+		/// \returns true if file opened successfully
+		bool open(const string &path, const string &separator=",", const string &comment="#");
+
+	/// \section Stages
+
+		/// Pass the first row straight to the output, skipping all stages.
+		ofxCsvPipeline& header(bool pass=true);
+
+		/// Only keep rows for which the filter returns true.
+		ofxCsvPipeline& filter(Filter filter);
+
+		/// Modify each row, ie. to compute a new col.
+		ofxCsvPipeline& transform(Transform transform);
+
+		/// Drop the first n rows reaching this stage.
+		ofxCsvPipeline& skip(size_t n);
+
+		/// Stop after n rows have reached this stage.
+		ofxCsvPipeline& take(size_t n);
+
+	/// \section Sinks
+
+		/// Run the pipeline into a CSV file.
+		///
+		/// Creates any required folders in the path, if needed.
+		///
+		/// \param path File path to save.
+		/// \param quote Should the fields be double quoted? default false.
+		/// \param separator Field separator string, default comma ",".
+		/// \returns true if file saved successfully
+		bool toFile(const string &path, bool quote=false, const string &separator=",");
+
+		/// Run the pipeline into a table.
+		///
+		/// \param csv Table to load, clears any currently loaded data.
+		/// \returns the number of rows
+		size_t toTable(ofxCsv &csv);
+
+		/// Run the pipeline into a new table.
+		ofxCsv toTable();
+
+		/// Run the pipeline, calling a function for each output row.
+		/// \returns the number of rows
+		size_t forEach(std::function<void(const ofxCsvRow &row)> func);
+
+		/// Run the pipeline, counting the output rows.
+		size_t count();
+
+	/// \section Iteration
+
+		/// Run the pipeline until the next output row.
+		/// \returns true if a row was output, false when done
+		bool next();
+
+		/// Get the current output row, valid until the next row.
+		const ofxCsvRow& getRow() const;
+
+		/// Iterate over the remaining output rows, runs to the first row.
+		iterator begin();
+
+		/// End iterator.
+		iterator end();
+
+	protected:
+
+		/// a single pipeline stage
+		struct Stage {
+			enum Type {
+				FILTER,
+				TRANSFORM,
+				SKIP,
+				TAKE
+			};
+			Type type;           //< stage type
+			Filter filter;       //< filter function
+			Transform transform; //< transform function
+			size_t count;        //< skip or take count
+			size_t seen;         //< rows seen by a skip or take stage
+		};
+
+		/// add a stage & return this pipeline for chaining
+		ofxCsvPipeline& addStage(const Stage &stage);
+
+		ofxCsvReader reader;  //< input rows
+		vector<Stage> stages; //< stages, in order
+		ofxCsvRow row;        //< current row, reused between rows
+		bool passHeader;      //< pass the first row straight through?
+		bool headerDone;      //< has the first row been read?
+		bool done;            //< has a take stage been satisfied?
+};
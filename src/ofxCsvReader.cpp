@@ -0,0 +1,406 @@
+/**
+ *  ofxCsvReader.cpp
+ *  Inspired and based on Ben Fry's [table class](http://benfry.com/writing/map/Table.pde)
+ *
+ *  The MIT License
+ *
+ *  Copyright (c) 2011-2019 Paul Vollmer, https://paulvollmer.net
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ *
+ *  @modified           2026.10.18
+ *  @version            0.2.1
+ */
+
+#include "ofxCsvReader.h"
+
+#include "ofxCsvParse.h"
+#include "ofLog.h"
+#include "ofUtils.h"
+#include "ofFileUtils.h"
+
+#include <cstring>
+
+/// initial read buffer size, grows to fit long lines
+static const size_t s_bufferSize = 1 << 20;
+
+/// ROW VIEW
+
+//--------------------------------------------------
+ofxCsvRowView::ofxCsvRowView() {
+	line = nullptr;
+	lineSize = 0;
+	lineNumber = 0;
+	offset = 0;
+}
+
+//--------------------------------------------------
+unsigned int ofxCsvRowView::getNumCols() const {
+	return fields.size();
+}
+
+//--------------------------------------------------
+int ofxCsvRowView::getInt(int col) const {
+	if(col < 0 || (size_t)col >= fields.size()) {
+		return 0;
+	}
+	int v = 0;
+	const ofxCsvFieldView &field = fields[col];
+	if(field.quoted) {
+		string s = field.str();
+		ofxCsvParse::toInteger(s.data(), s.data() + s.size(), v, nullptr, format);
+	}
+	else {
+		ofxCsvParse::toInteger(field.data, field.data + field.size, v, nullptr, format);
+	}
+	return v;
+}
+
+//--------------------------------------------------
+int64_t ofxCsvRowView::getInt64(int col) const {
+	if(col < 0 || (size_t)col >= fields.size()) {
+		return 0;
+	}
+	int64_t v = 0;
+	const ofxCsvFieldView &field = fields[col];
+	if(field.quoted) {
+		string s = field.str();
+		ofxCsvParse::toInt64(s.data(), s.data() + s.size(), v, format);
+	}
+	else {
+		ofxCsvParse::toInt64(field.data, field.data + field.size, v, format);
+	}
+	return v;
+}
+
+//--------------------------------------------------
+float ofxCsvRowView::getFloat(int col) const {
+	if(col < 0 || (size_t)col >= fields.size()) {
+		return 0.0f;
+	}
+	float v = 0;
+	const ofxCsvFieldView &field = fields[col];
+	if(field.quoted) {
+		string s = field.str();
+		ofxCsvParse::toFloat(s.data(), s.data() + s.size(), v, format);
+	}
+	else {
+		ofxCsvParse::toFloat(field.data, field.data + field.size, v, format);
+	}
+	return v;
+}
+
+//--------------------------------------------------
+string ofxCsvRowView::getString(int col) const {
+	if(col < 0 || (size_t)col >= fields.size()) {
+		return "";
+	}
+	return fields[col].str();
+}
+
+//--------------------------------------------------
+bool ofxCsvRowView::getBool(int col) const {
+	if(col < 0 || (size_t)col >= fields.size()) {
+		return false;
+	}
+	bool v = false;
+	string s = fields[col].str();
+	ofxCsvParse::toBool(s.data(), s.data() + s.size(), v);
+	return v;
+}
+
+//--------------------------------------------------
+const ofxCsvFieldView& ofxCsvRowView::operator[](size_t index) const {
+	return fields[index];
+}
+
+//--------------------------------------------------
+const vector<ofxCsvFieldView>& ofxCsvRowView::getFields() const {
+	return fields;
+}
+
+//--------------------------------------------------
+string ofxCsvRowView::getLine() const {
+	return string(line, lineSize);
+}
+
+//--------------------------------------------------
+const char* ofxCsvRowView::getLineData() const {
+	return line;
+}
+
+//--------------------------------------------------
+size_t ofxCsvRowView::getLineSize() const {
+	return lineSize;
+}
+
+//--------------------------------------------------
+size_t ofxCsvRowView::getLineNumber() const {
+	return lineNumber;
+}
+
+//--------------------------------------------------
+uint64_t ofxCsvRowView::getOffset() const {
+	return offset;
+}
+
+//--------------------------------------------------
+ofxCsvRow ofxCsvRowView::toRow() const {
+	ofxCsvRow copy;
+	vector<string> &cols = copy.getData();
+	cols.resize(fields.size());
+	for(size_t i = 0; i < fields.size(); i++) {
+		fields[i].str(cols[i]);
+	}
+	return copy;
+}
+
+//--------------------------------------------------
+size_t ofxCsvRowView::size() const {
+	return fields.size();
+}
+
+//--------------------------------------------------
+bool ofxCsvRowView::empty() const {
+	return fields.empty();
+}
+
+/// READER
+
+//--------------------------------------------------
+ofxCsvReader::ofxCsvReader() {
+	commentPrefix = "#";
+	file = nullptr;
+	start = 0;
+	filled = 0;
+	bufferOffset = 0;
+	eof = true;
+	lineCount = 0;
+	rowCount = 0;
+}
+
+//--------------------------------------------------
+ofxCsvReader::ofxCsvReader(ofxCsvReader &&from) : ofxCsvReader() {
+	*this = std::move(from);
+}
+
+//--------------------------------------------------
+ofxCsvReader& ofxCsvReader::operator=(ofxCsvReader &&from) {
+	if(this != &from) {
+		close();
+		filePath = std::move(from.filePath);
+		commentPrefix = std::move(from.commentPrefix);
+		numberFormat = from.numberFormat;
+		tokenizer = from.tokenizer;
+		file = from.file;
+		buffer = std::move(from.buffer); // row views stay valid
+		start = from.start;
+		filled = from.filled;
+		bufferOffset = from.bufferOffset;
+		eof = from.eof;
+		lineCount = from.lineCount;
+		rowCount = from.rowCount;
+		row = std::move(from.row);
+		from.file = nullptr;
+		from.close();
+	}
+	return *this;
+}
+
+//--------------------------------------------------
+ofxCsvReader::~ofxCsvReader() {
+	close();
+}
+
+/// FILE IO
+
+//--------------------------------------------------
+bool ofxCsvReader::open(const string &path, const string &separator, const string &comment) {
+
+	close();
+	filePath = path;
+	tokenizer.setSeparator(separator);
+	commentPrefix = comment;
+
+	// do some checks
+	ofFile info(ofToDataPath(filePath), ofFile::Reference);
+	if(!info.exists()) {
+		ofLogError("ofxCsvReader") << "Cannot open " << filePath << ": file not found";
+		return false;
+	}
+	if(info.isDirectory()) {
+		ofLogError("ofxCsvReader") << "Cannot open " << filePath << ": \"file\" is actually a directory";
+		return false;
+	}
+	file = fopen(info.getAbsolutePath().c_str(), "rb");
+	if(!file) {
+		ofLogError("ofxCsvReader") << "Cannot open " << filePath << ": file not readable";
+		return false;
+	}
+	buffer.resize(s_bufferSize);
+	eof = false;
+
+	ofLogVerbose("ofxCsvReader") << "Opened " << filePath;
+	return true;
+}
+
+//--------------------------------------------------
+void ofxCsvReader::close() {
+	if(file) {
+		fclose(file);
+		file = nullptr;
+	}
+	buffer.clear();
+	start = 0;
+	filled = 0;
+	bufferOffset = 0;
+	eof = true;
+	lineCount = 0;
+	rowCount = 0;
+	row = ofxCsvRowView();
+}
+
+//--------------------------------------------------
+bool ofxCsvReader::isOpen() const {
+	return file != nullptr;
+}
+
+/// READING
+
+//--------------------------------------------------
+bool ofxCsvReader::next() {
+	while(true) {
+		const char *begin = buffer.data() + start;
+		const char *end = buffer.data() + filled;
+
+		// make sure a whole line is buffered
+		if(!eof && !memchr(begin, '\n', end - begin)) {
+			fill();
+			continue;
+		}
+		if(begin == end) { // done
+			row = ofxCsvRowView();
+			return false;
+		}
+
+		const char *lineEnd;
+		const char *following = ofxCsvTokenizer::nextLine(begin, end, lineEnd);
+		uint64_t offset = bufferOffset + start;
+		start = following - buffer.data();
+		lineCount++;
+
+		// skip empty & comment lines
+		size_t size = lineEnd - begin;
+		if(size == 0) {
+			continue;
+		}
+		if(!commentPrefix.empty() && size >= commentPrefix.size() &&
+		   memcmp(begin, commentPrefix.data(), commentPrefix.size()) == 0) {
+			continue;
+		}
+
+		tokenizer.split(begin, size, row.fields);
+		row.line = begin;
+		row.lineSize = size;
+		row.lineNumber = lineCount;
+		row.offset = offset;
+		row.format = numberFormat;
+		rowCount++;
+		return true;
+	}
+}
+
+//--------------------------------------------------
+const ofxCsvRowView& ofxCsvReader::getRow() const {
+	return row;
+}
+
+//--------------------------------------------------
+ofxCsvReader::iterator ofxCsvReader::begin() {
+	return next() ? iterator(this) : iterator();
+}
+
+//--------------------------------------------------
+ofxCsvReader::iterator ofxCsvReader::end() {
+	return iterator();
+}
+
+//--------------------------------------------------
+size_t ofxCsvReader::getNumRows() const {
+	return rowCount;
+}
+
+//--------------------------------------------------
+string ofxCsvReader::getPath() const {
+	return filePath;
+}
+
+//--------------------------------------------------
+string ofxCsvReader::getSeparator() const {
+	return tokenizer.getSeparator();
+}
+
+//--------------------------------------------------
+string ofxCsvReader::getComment() const {
+	return commentPrefix;
+}
+
+//--------------------------------------------------
+void ofxCsvReader::setNumberFormat(const ofxCsvNumberFormat &format) {
+	numberFormat = format;
+}
+
+//--------------------------------------------------
+ofxCsvNumberFormat ofxCsvReader::getNumberFormat() const {
+	return numberFormat;
+}
+
+// PROTECTED
+
+//--------------------------------------------------
+bool ofxCsvReader::fill() {
+	if(!file) {
+		eof = true;
+		return false;
+	}
+
+	// keep the unread text
+	if(start > 0) {
+		memmove(buffer.data(), buffer.data() + start, filled - start);
+		bufferOffset += start;
+		filled -= start;
+		start = 0;
+	}
+
+	// grow for lines longer than the buffer
+	if(filled == buffer.size()) {
+		buffer.resize(max(buffer.size() * 2, s_bufferSize));
+	}
+
+	size_t read = fread(buffer.data() + filled, 1, buffer.size() - filled, file);
+	filled += read;
+	if(read == 0) {
+		if(ferror(file)) {
+			ofLogError("ofxCsvReader") << "Could not read from " << filePath;
+		}
+		eof = true;
+		return false;
+	}
+	return true;
+}
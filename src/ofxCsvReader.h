@@ -0,0 +1,273 @@
+/**
+ *  ofxCsvReader.h
+ *  Inspired and based on Ben Fry's [table class](http://benfry.com/writing/map/Table.pde)
+ *
+ *  The MIT License
+ *
+ *  Copyright (c) 2011-2019 Paul Vollmer, https://paulvollmer.net
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ *
+ *  @modified           2026.10.18
+ *  @version            0.2.1
+ */
+
+#pragma once
+
+#include "ofxCsvRow.h"
+#include "ofxCsvTokenizer.h"
+#include "ofxCsvParse.h"
+
+#include <iterator>
+
+/// \class ofxCsvRowView
+/// \brief a row read by ofxCsvReader, as field views into the read buffer
+///
+/// Only valid until the reader reads the next row, use toRow() to keep a
+/// copy.
+class ofxCsvRowView {
+
+	public:
+
+		ofxCsvRowView();
+
+	/// \section Get Fields
+
+		/// Get the current number of cols.
+		unsigned int getNumCols() const;
+
+		/// Get a field as an integer value.
+		///
+		/// Uses the reader's number format.
+		///
+		/// \param col Column number
+		/// \returns the value or 0 if not found.
+		int getInt(int col) const;
+
+		/// Get a field as a 64 bit integer value.
+		///
+		/// Uses the reader's number format.
+		///
+		/// \param col Column number
+		/// \returns the value or 0 if not found.
+		int64_t getInt64(int col) const;
+
+		/// Get a field as a float value.
+		///
+		/// Uses the reader's number format.
+		///
+		/// \param col Column number
+		/// \returns the value or 0.0 if not found.
+		float getFloat(int col) const;
+
+		/// Get a field as a string value.
+		///
+		/// \param col Column number
+		/// \returns the value or "" if not found.
+		string getString(int col) const;
+
+		/// Get a field as a boolean value.
+		///
+		/// \param col Column number
+		/// \returns the value or false if not found.
+		bool getBool(int col) const;
+
+	/// \section Raw Access
+
+		/// Field view access via col index.
+		const ofxCsvFieldView& operator[](size_t index) const;
+
+		/// Get the field views.
+		const vector<ofxCsvFieldView>& getFields() const;
+
+		/// Get the raw line text, without the line ending.
+		string getLine() const;
+
+		/// Get the raw line text start.
+		const char* getLineData() const;
+
+		/// Get the raw line text size.
+		size_t getLineSize() const;
+
+		/// Get the line number in the file, starting at 1.
+		size_t getLineNumber() const;
+
+		/// Get the byte offset of the line in the file.
+		uint64_t getOffset() const;
+
+		/// Copy the fields into a row.
+		ofxCsvRow toRow() const;
+
+		/// Number of cols.
+		size_t size() const;
+
+		/// Is the row empty?
+		bool empty() const;
+
+	protected:
+
+		friend class ofxCsvReader;
+
+		vector<ofxCsvFieldView> fields; //< field views into the line
+		const char *line;               //< raw line text
+		size_t lineSize;                //< raw line text size
+		size_t lineNumber;              //< line number, starting at 1
+		uint64_t offset;                //< line byte offset in the file
+		ofxCsvNumberFormat format;      //< number format for getInt() & getFloat()
+};
+
+/// \class ofxCsvReader
+/// \brief reads a CSV file row by row without loading the whole file
+///
+/// The file is read in blocks & each row is tokenized when it is reached,
+/// so iteration can stop early without reading the rest of the file:
+///
+///     ofxCsvReader reader;
+///     reader.open("huge.csv");
+///     for(auto &row : reader) {
+///         if(row.getString(0) == "needle") {
+///             ofLog() << "found on line " << row.getLineNumber();
+///             break;
+///         }
+///     }
+///
+/// Or straight from a table's current file path & separator without loading
+/// it, see ofxCsv::rows():
+///
+///     for(auto &row : csv.rows()) { ... }
+///
+/// Like ofxCsv::load(), empty lines & lines beginning with the comment
+/// prefix are skipped & quoted fields can't span lines.
+class ofxCsvReader {
+
+	public:
+
+		/// Input iterator over the remaining rows.
+		class iterator {
+			public:
+				typedef std::input_iterator_tag iterator_category;
+				typedef ofxCsvRowView value_type;
+				typedef std::ptrdiff_t difference_type;
+				typedef const ofxCsvRowView* pointer;
+				typedef const ofxCsvRowView& reference;
+
+				iterator() : reader(nullptr) {}
+				explicit iterator(ofxCsvReader *reader) : reader(reader) {}
+
+				reference operator*() const {return reader->getRow();}
+				pointer operator->() const {return &reader->getRow();}
+				iterator& operator++() {
+					if(!reader->next()) {
+						reader = nullptr;
+					}
+					return *this;
+				}
+				void operator++(int) {++(*this);}
+				bool operator==(const iterator &i) const {return reader == i.reader;}
+				bool operator!=(const iterator &i) const {return reader != i.reader;}
+
+			private:
+				ofxCsvReader *reader; //< reader or nullptr at the end
+		};
+
+		/// Constructor. Initializes and starts the class.
+		ofxCsvReader();
+
+		/// Move constructor.
+		ofxCsvReader(ofxCsvReader &&from);
+
+		/// Move operator.
+		ofxCsvReader& operator=(ofxCsvReader &&from);
+
+		/// Destructor. Closes the file.
+		virtual ~ofxCsvReader();
+
+	/// \section File IO
+
+		/// Open a CSV file for reading.
+		///
+		/// Closes any currently open file.
+		///
+		/// \param path File path to open.
+		/// \param separator Field separator string, default comma ",".
+		/// \param comment Comment line prefix string, default "#".
+		/// \returns true if file opened successfully
+		bool open(const string &path, const string &separator=",", const string &comment="#");
+
+		/// Close the current file.
+		void close();
+
+		/// Is a file open?
+		bool isOpen() const;
+
+	/// \section Reading
+
+		/// Read the next row.
+		/// \returns true if a row was read, false at the end of the file
+		bool next();
+
+		/// Get the current row, valid until the next row is read.
+		const ofxCsvRowView& getRow() const;
+
+		/// Iterate over the remaining rows, reads the first row.
+		iterator begin();
+
+		/// End iterator.
+		iterator end();
+
+		/// Get the current number of rows read.
+		size_t getNumRows() const;
+
+		/// Get the current file path.
+		string getPath() const;
+
+		/// Get the field separator, default comma ",".
+		string getSeparator() const;
+
+		/// Get the current comment line prefix, default "#".
+		string getComment() const;
+
+		/// Set the decimal mark & thousands separator for the rows' getInt()
+		/// & getFloat(), default "1234.5".
+		void setNumberFormat(const ofxCsvNumberFormat &format);
+
+		/// Get the number format, default "1234.5".
+		ofxCsvNumberFormat getNumberFormat() const;
+
+	protected:
+
+		/// read more of the file into the buffer, keeping unread text
+		/// \returns false if nothing more could be read
+		bool fill();
+
+		string filePath;        //< current file path
+		string commentPrefix;   //< comment line prefix, default: "#"
+		ofxCsvTokenizer tokenizer; //< splits lines into fields
+		ofxCsvNumberFormat numberFormat; //< number format for the rows
+
+		FILE *file;             //< current file
+		vector<char> buffer;    //< read buffer
+		size_t start;           //< start of unread text in the buffer
+		size_t filled;          //< end of read text in the buffer
+		uint64_t bufferOffset;  //< file offset of the buffer start
+		bool eof;               //< has the whole file been read?
+		size_t lineCount;       //< number of lines read
+		size_t rowCount;        //< number of rows read
+		ofxCsvRowView row;      //< current row
+};
@@ -0,0 +1,235 @@
+/**
+ *  ofxCsvRollingStats.cpp
+ *  Inspired and based on Ben Fry's [table class](http://benfry.com/writing/map/Table.pde)
+ *
+ *  The MIT License
+ *
+ *  Copyright (c) 2011-2019 Paul Vollmer, https://paulvollmer.net
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ *
+ *  @modified           2026.10.18
+ *  @version            0.2.1
+ */
+
+#include "ofxCsvRollingStats.h"
+
+#include "ofxCsv.h"
+#include "ofxCsvParse.h"
+
+#include <cmath>
+#include <limits>
+
+//--------------------------------------------------
+ofxCsvRollingStats::ofxCsvRollingStats(size_t window, double alpha) {
+	this->window = max(window, (size_t)1);
+	this->alpha = min(max(alpha, 0.0), 1.0);
+	clear();
+}
+
+/// SETTINGS
+
+//--------------------------------------------------
+void ofxCsvRollingStats::setWindow(size_t window) {
+	this->window = max(window, (size_t)1);
+	clear();
+}
+
+//--------------------------------------------------
+size_t ofxCsvRollingStats::getWindow() const {
+	return window;
+}
+
+//--------------------------------------------------
+void ofxCsvRollingStats::setAlpha(double alpha) {
+	this->alpha = min(max(alpha, 0.0), 1.0);
+	clear();
+}
+
+//--------------------------------------------------
+double ofxCsvRollingStats::getAlpha() const {
+	return alpha;
+}
+
+/// ADDING VALUES
+
+//--------------------------------------------------
+void ofxCsvRollingStats::add(double value) {
+	if(std::isnan(value)) {
+		return;
+	}
+
+	// running sum over the ring, replacing the oldest value once full
+	size_t slot = added % window;
+	if(ring.size() < window) {
+		ring.push_back(value);
+		sum += value;
+	}
+	else {
+		sum += value - ring[slot];
+		ring[slot] = value;
+	}
+	if(slot == window - 1) {
+		// resum once per window so rounding errors from the subtractions
+		// can't build up over long recordings, still O(1) amortized
+		sum = 0;
+		for(double v : ring) {
+			sum += v;
+		}
+	}
+
+	// monotonic deques: values which can never be the min or max again
+	// are popped from the back & values which left the window from the front
+	while(!minima.empty() && minima.back().value >= value) {
+		minima.pop_back();
+	}
+	minima.push_back({added, value});
+	while(!maxima.empty() && maxima.back().value <= value) {
+		maxima.pop_back();
+	}
+	maxima.push_back({added, value});
+	if(minima.front().index + window <= added) {
+		minima.pop_front();
+	}
+	if(maxima.front().index + window <= added) {
+		maxima.pop_front();
+	}
+
+	ewma = added == 0 ? value : ewma + alpha * (value - ewma);
+	added++;
+}
+
+//--------------------------------------------------
+size_t ofxCsvRollingStats::update(const ofxCsv &csv, int col, int firstRow) {
+	if(!started) {
+		nextRow = max(firstRow, 0);
+		started = true;
+	}
+	size_t read = 0;
+	ofxCsvNumberFormat format = csv.getNumberFormat();
+	for(; nextRow < csv.getNumRows(); nextRow++, read++) {
+		if(csv.isNull(nextRow, col)) {
+			continue;
+		}
+		const string &field = *((csv.begin() + nextRow)->begin() + col);
+		double value;
+		if(ofxCsvParse::toDouble(field.data(), field.data() + field.size(), value, format)) {
+			add(value);
+		}
+	}
+	return read;
+}
+
+//--------------------------------------------------
+void ofxCsvRollingStats::apply(const ofxCsvColumn<double> &column, Stat stat, ofxCsvColumn<double> &out) {
+	clear();
+	out.clear();
+	out.reserve(column.size());
+	for(size_t i = 0; i < column.size(); i++) {
+		if(column.isNull(i) || std::isnan(column[i])) {
+			out.pushNull();
+			continue;
+		}
+		add(column[i]);
+		out.push(get(stat));
+	}
+}
+
+//--------------------------------------------------
+void ofxCsvRollingStats::clear() {
+	ring.clear();
+	sum = 0;
+	ewma = 0;
+	added = 0;
+	minima.clear();
+	maxima.clear();
+	nextRow = 0;
+	started = false;
+}
+
+/// STATISTICS
+
+//--------------------------------------------------
+double ofxCsvRollingStats::get(Stat stat) const {
+	switch(stat) {
+		case SUM:
+			return ring.empty() ? std::numeric_limits<double>::quiet_NaN() : getSum();
+		case MEAN:
+			return getMean();
+		case MIN:
+			return getMin();
+		case MAX:
+			return getMax();
+		case EWMA:
+			return getEwma();
+	}
+	return std::numeric_limits<double>::quiet_NaN();
+}
+
+//--------------------------------------------------
+double ofxCsvRollingStats::getSum() const {
+	return sum;
+}
+
+//--------------------------------------------------
+double ofxCsvRollingStats::getMean() const {
+	if(ring.empty()) {
+		return std::numeric_limits<double>::quiet_NaN();
+	}
+	return sum / ring.size();
+}
+
+//--------------------------------------------------
+double ofxCsvRollingStats::getMin() const {
+	if(minima.empty()) {
+		return std::numeric_limits<double>::quiet_NaN();
+	}
+	return minima.front().value;
+}
+
+//--------------------------------------------------
+double ofxCsvRollingStats::getMax() const {
+	if(maxima.empty()) {
+		return std::numeric_limits<double>::quiet_NaN();
+	}
+	return maxima.front().value;
+}
+
+//--------------------------------------------------
+double ofxCsvRollingStats::getEwma() const {
+	if(added == 0) {
+		return std::numeric_limits<double>::quiet_NaN();
+	}
+	return ewma;
+}
+
+//--------------------------------------------------
+size_t ofxCsvRollingStats::getNumValues() const {
+	return ring.size();
+}
+
+//--------------------------------------------------
+uint64_t ofxCsvRollingStats::getNumAdded() const {
+	return added;
+}
+
+//--------------------------------------------------
+size_t ofxCsvRollingStats::getNextRow() const {
+	return nextRow;
+}
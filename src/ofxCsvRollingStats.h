@@ -0,0 +1,178 @@
+/**
+ *  ofxCsvRollingStats.h
+ *  Inspired and based on Ben Fry's [table class](http://benfry.com/writing/map/Table.pde)
+ *
+ *  The MIT License
+ *
+ *  Copyright (c) 2011-2019 Paul Vollmer, https://paulvollmer.net
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ *
+ *  @modified           2026.10.18
+ *  @version            0.2.1
+ */
+
+#pragma once
+
+#include "ofxCsvColumn.h"
+
+#include <deque>
+
+/// \class ofxCsvRollingStats
+/// \brief moving sum, mean, min, max, & EWMA over the last N values
+///
+/// Each value is added in O(1) amortized time: the sum is kept as a running
+/// total over a ring buffer of the window & the min & max as monotonic
+/// deques, so live plots can update as rows arrive:
+///
+///     ofxCsvRollingStats stats(60); // last 60 values
+///     ...
+///     stats.add(temperature);
+///     recorder.appendRow(ofGetElapsedTimef(), temperature);
+///     ofDrawBitmapString(ofToString(stats.getMean()), 20, 20);
+///
+/// Or over a whole column, one output value per row:
+///
+///     ofxCsvColumn<double> temperature, smoothed;
+///     temperature.load(csv, 1, 1);
+///     stats.apply(temperature, ofxCsvRollingStats::MEAN, smoothed);
+///
+/// Or incrementally over a table's appended rows:
+///
+///     stats.update(csv, 1, 1); // reads rows added since the last update
+///
+/// Nulls & NaN values are skipped & don't take a place in the window.
+class ofxCsvRollingStats {
+
+	public:
+
+		/// rolling statistics
+		enum Stat {
+			SUM,  //< sum of the window's values
+			MEAN, //< mean of the window's values
+			MIN,  //< min of the window's values
+			MAX,  //< max of the window's values
+			EWMA  //< exponentially weighted moving average of all values
+		};
+
+		/// Constructor.
+		///
+		/// \param window Number of values in the window, minimum 1.
+		/// \param alpha EWMA smoothing factor from 0 to 1, higher follows new
+		///              values more closely.
+		ofxCsvRollingStats(size_t window=100, double alpha=0.1);
+
+	/// \section Settings
+
+		/// Set the number of values in the window, minimum 1. Clears the
+		/// current values.
+		void setWindow(size_t window);
+
+		/// Get the number of values in the window.
+		size_t getWindow() const;
+
+		/// Set the EWMA smoothing factor from 0 to 1. Clears the current
+		/// values.
+		void setAlpha(double alpha);
+
+		/// Get the EWMA smoothing factor.
+		double getAlpha() const;
+
+	/// \section Adding Values
+
+		/// Add a value, dropping the oldest value if the window is full.
+		void add(double value);
+
+		/// Add the values of rows appended to a table since the last update.
+		///
+		/// Uses the table's number format & null tokens. The table should
+		/// only grow between updates, call clear() to start over.
+		///
+		/// \param csv Table to read from.
+		/// \param col Column number.
+		/// \param firstRow First row to read on the first update, ie. 1 to
+		///                 skip a header row.
+		/// \returns the number of rows read
+		size_t update(const ofxCsv &csv, int col, int firstRow=0);
+
+		/// Compute a statistic for each row of a column from the start.
+		///
+		/// Clears the current values first. Null rows are null in the output.
+		///
+		/// \param column Input values.
+		/// \param stat Statistic to compute.
+		/// \param out Cleared & set to 1 value per input row.
+		void apply(const ofxCsvColumn<double> &column, Stat stat, ofxCsvColumn<double> &out);
+
+		/// Clear the current values.
+		void clear();
+
+	/// \section Statistics
+
+		/// Get a statistic.
+		/// \returns the value or NaN if no values were added
+		double get(Stat stat) const;
+
+		/// Get the sum of the values in the window, 0 if empty.
+		double getSum() const;
+
+		/// Get the mean of the values in the window.
+		/// \returns the mean or NaN if empty
+		double getMean() const;
+
+		/// Get the min value in the window.
+		/// \returns the min or NaN if empty
+		double getMin() const;
+
+		/// Get the max value in the window.
+		/// \returns the max or NaN if empty
+		double getMax() const;
+
+		/// Get the exponentially weighted moving average of all values.
+		/// \returns the average or NaN if empty
+		double getEwma() const;
+
+		/// Get the number of values in the window.
+		size_t getNumValues() const;
+
+		/// Get the total number of values added.
+		uint64_t getNumAdded() const;
+
+		/// Get the next table row update() reads.
+		size_t getNextRow() const;
+
+	protected:
+
+		/// a value in a min or max deque
+		struct Entry {
+			uint64_t index; //< number of values added before this one
+			double value;   //< value
+		};
+
+		size_t window;       //< window size
+		double alpha;        //< EWMA smoothing factor
+		vector<double> ring; //< window values, oldest overwritten first
+		double sum;          //< running sum of the ring values
+		double ewma;         //< current EWMA
+		uint64_t added;      //< number of values added
+		std::deque<Entry> minima; //< increasing values, front is the min
+		std::deque<Entry> maxima; //< decreasing values, front is the max
+		size_t nextRow;      //< next row for update()
+		bool started;        //< has update() been called?
+};
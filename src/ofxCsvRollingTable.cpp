@@ -0,0 +1,233 @@
+/**
+ *  ofxCsvRollingTable.cpp
+ *  Inspired and based on Ben Fry's [table class](http://benfry.com/writing/map/Table.pde)
+ *
+ *  The MIT License
+ *
+ *  Copyright (c) 2011-2019 Paul Vollmer, https://paulvollmer.net
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ *
+ *  @modified           2026.10.18
+ *  @version            0.2.1
+ */
+
+#include "ofxCsvRollingTable.h"
+
+#include "ofLog.h"
+
+//--------------------------------------------------
+ofxCsvRollingTable::ofxCsvRollingTable(size_t capacity) {
+	this->capacity = max(capacity, (size_t)1);
+	head = 0;
+	count = 0;
+}
+
+/// CAPACITY
+
+//--------------------------------------------------
+void ofxCsvRollingTable::setCapacity(size_t newCapacity) {
+	newCapacity = max(newCapacity, (size_t)1);
+	if(newCapacity == capacity) {
+		return;
+	}
+
+	// linearize the newest rows
+	size_t keep = min(count, newCapacity);
+	vector<ofxCsvRow> linear;
+	linear.reserve(keep);
+	for(size_t i = count - keep; i < count; i++) {
+		linear.push_back(std::move(rows[slot(i)]));
+	}
+	rows.swap(linear);
+	capacity = newCapacity;
+	head = 0;
+	count = keep;
+}
+
+//--------------------------------------------------
+size_t ofxCsvRollingTable::getCapacity() const {
+	return capacity;
+}
+
+//--------------------------------------------------
+bool ofxCsvRollingTable::isFull() const {
+	return count == capacity;
+}
+
+/// ROW ACCESS
+
+//--------------------------------------------------
+unsigned int ofxCsvRollingTable::getNumRows() const {
+	return count;
+}
+
+//--------------------------------------------------
+void ofxCsvRollingTable::addRow(const ofxCsvRow &row) {
+	nextSlot() = row; // assign over the old fields to reuse their storage
+}
+
+//--------------------------------------------------
+ofxCsvRow& ofxCsvRollingTable::addRow() {
+	ofxCsvRow &row = nextSlot();
+	row.clear();
+	return row;
+}
+
+//--------------------------------------------------
+void ofxCsvRollingTable::removeOldest() {
+	if(count == 0) {
+		return;
+	}
+	rows[head].clear();
+	head = slot(1);
+	count--;
+}
+
+//--------------------------------------------------
+void ofxCsvRollingTable::clear() {
+	rows.clear();
+	head = 0;
+	count = 0;
+}
+
+//--------------------------------------------------
+void ofxCsvRollingTable::print() const {
+	for(auto &row : *this) {
+		ofLog() << row;
+	}
+}
+
+/// FILE IO
+
+//--------------------------------------------------
+void ofxCsvRollingTable::toCsv(ofxCsv &csv) const {
+	vector<ofxCsvRow> linear(begin(), end());
+	csv.load(linear);
+}
+
+//--------------------------------------------------
+bool ofxCsvRollingTable::save(const string &path, bool quote, const string &separator) const {
+	ofxCsv csv;
+	toCsv(csv);
+	return csv.save(path, quote, separator);
+}
+
+/// RAW ACCESS
+
+//--------------------------------------------------
+ofxCsvRollingTable::iterator ofxCsvRollingTable::begin() {
+	return iterator(this, 0);
+}
+
+//--------------------------------------------------
+ofxCsvRollingTable::iterator ofxCsvRollingTable::end() {
+	return iterator(this, count);
+}
+
+//--------------------------------------------------
+ofxCsvRollingTable::const_iterator ofxCsvRollingTable::begin() const {
+	return const_iterator(this, 0);
+}
+
+//--------------------------------------------------
+ofxCsvRollingTable::const_iterator ofxCsvRollingTable::end() const {
+	return const_iterator(this, count);
+}
+
+//--------------------------------------------------
+std::reverse_iterator<ofxCsvRollingTable::iterator> ofxCsvRollingTable::rbegin() {
+	return std::reverse_iterator<iterator>(end());
+}
+
+//--------------------------------------------------
+std::reverse_iterator<ofxCsvRollingTable::iterator> ofxCsvRollingTable::rend() {
+	return std::reverse_iterator<iterator>(begin());
+}
+
+//--------------------------------------------------
+std::reverse_iterator<ofxCsvRollingTable::const_iterator> ofxCsvRollingTable::rbegin() const {
+	return std::reverse_iterator<const_iterator>(end());
+}
+
+//--------------------------------------------------
+std::reverse_iterator<ofxCsvRollingTable::const_iterator> ofxCsvRollingTable::rend() const {
+	return std::reverse_iterator<const_iterator>(begin());
+}
+
+//--------------------------------------------------
+ofxCsvRow& ofxCsvRollingTable::operator[](size_t index) {
+	return rows[slot(index)];
+}
+
+//--------------------------------------------------
+const ofxCsvRow& ofxCsvRollingTable::operator[](size_t index) const {
+	return rows[slot(index)];
+}
+
+//--------------------------------------------------
+ofxCsvRow& ofxCsvRollingTable::at(size_t index) {
+	if(index >= count) {
+		throw std::out_of_range("ofxCsvRollingTable::at");
+	}
+	return rows[slot(index)];
+}
+
+//--------------------------------------------------
+ofxCsvRow& ofxCsvRollingTable::front() {
+	return rows[head];
+}
+
+//--------------------------------------------------
+ofxCsvRow& ofxCsvRollingTable::back() {
+	return rows[slot(count-1)];
+}
+
+//--------------------------------------------------
+size_t ofxCsvRollingTable::size() const {
+	return count;
+}
+
+//--------------------------------------------------
+bool ofxCsvRollingTable::empty() const {
+	return count == 0;
+}
+
+// PROTECTED
+
+//--------------------------------------------------
+ofxCsvRow& ofxCsvRollingTable::nextSlot() {
+	if(count == capacity) { // evict the oldest
+		size_t s = head;
+		head = slot(1);
+		return rows[s];
+	}
+	size_t s = slot(count);
+	count++;
+	if(s == rows.size()) { // still growing
+		rows.push_back(ofxCsvRow());
+	}
+	return rows[s];
+}
+
+//--------------------------------------------------
+size_t ofxCsvRollingTable::slot(size_t index) const {
+	size_t s = head + index;
+	return s >= capacity ? s - capacity : s;
+}
@@ -0,0 +1,201 @@
+/**
+ *  ofxCsvRollingTable.h
+ *  Inspired and based on Ben Fry's [table class](http://benfry.com/writing/map/Table.pde)
+ *
+ *  The MIT License
+ *
+ *  Copyright (c) 2011-2019 Paul Vollmer, https://paulvollmer.net
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ *
+ *  @modified           2026.10.18
+ *  @version            0.2.1
+ */
+
+#pragma once
+
+#include "ofxCsv.h"
+
+#include <iterator>
+
+/// \class ofxCsvRollingTable
+/// \brief fixed capacity table of the most recent rows
+///
+/// Rows are kept in a ring buffer: once full, adding a row overwrites the
+/// oldest in O(1) instead of shifting the whole table like
+/// ofxCsv::insertRow(0, row) or ofxCsv::removeRow(0). Access & iteration
+/// are always ordered oldest to newest:
+///
+///     ofxCsvRollingTable recent(300); // last 300 rows, ie. 10 s at 30 fps
+///     recent.addRow(row);
+///     for(auto &row : recent) {
+///         // oldest -> newest
+///     }
+///
+/// Overwritten rows reuse their existing string storage, so a full table
+/// does not allocate per added row.
+///
+class ofxCsvRollingTable {
+
+	public:
+
+		/// Random access iterator, oldest to newest.
+		template<typename Table, typename Row>
+		class Iterator {
+			public:
+				typedef std::random_access_iterator_tag iterator_category;
+				typedef Row value_type;
+				typedef std::ptrdiff_t difference_type;
+				typedef Row* pointer;
+				typedef Row& reference;
+
+				Iterator() : table(nullptr), index(0) {}
+				Iterator(Table *table, size_t index) : table(table), index(index) {}
+
+				reference operator*() const {return (*table)[index];}
+				pointer operator->() const {return &(*table)[index];}
+				reference operator[](difference_type n) const {return (*table)[index+n];}
+
+				Iterator& operator++() {index++; return *this;}
+				Iterator operator++(int) {Iterator i(*this); index++; return i;}
+				Iterator& operator--() {index--; return *this;}
+				Iterator operator--(int) {Iterator i(*this); index--; return i;}
+				Iterator& operator+=(difference_type n) {index += n; return *this;}
+				Iterator& operator-=(difference_type n) {index -= n; return *this;}
+				Iterator operator+(difference_type n) const {return Iterator(table, index+n);}
+				Iterator operator-(difference_type n) const {return Iterator(table, index-n);}
+				difference_type operator-(const Iterator &i) const {return (difference_type)index - (difference_type)i.index;}
+
+				bool operator==(const Iterator &i) const {return index == i.index;}
+				bool operator!=(const Iterator &i) const {return index != i.index;}
+				bool operator<(const Iterator &i) const {return index < i.index;}
+				bool operator>(const Iterator &i) const {return index > i.index;}
+				bool operator<=(const Iterator &i) const {return index <= i.index;}
+				bool operator>=(const Iterator &i) const {return index >= i.index;}
+
+			private:
+				Table *table; //< table being iterated
+				size_t index; //< logical row index, 0 is the oldest
+		};
+		typedef Iterator<ofxCsvRollingTable, ofxCsvRow> iterator;
+		typedef Iterator<const ofxCsvRollingTable, const ofxCsvRow> const_iterator;
+
+		/// Constructor.
+		///
+		/// \param capacity Max number of rows, minimum of 1.
+		ofxCsvRollingTable(size_t capacity=1000);
+
+	/// \section Capacity
+
+		/// Set the max number of rows.
+		///
+		/// Keeps the newest rows if the table shrinks.
+		///
+		/// \param capacity Max number of rows, minimum of 1.
+		void setCapacity(size_t capacity);
+
+		/// Get the max number of rows.
+		size_t getCapacity() const;
+
+		/// Is the table full, ie. will the next added row evict the oldest?
+		bool isFull() const;
+
+	/// \section Row Access
+
+		/// Get the current number of rows.
+		unsigned int getNumRows() const;
+
+		/// Add a row to the end, evicting the oldest row if full.
+		///
+		/// \param row Row to append.
+		void addRow(const ofxCsvRow &row);
+
+		/// Add an empty row to the end, evicting the oldest row if full.
+		///
+		/// \returns the new row
+		ofxCsvRow& addRow();
+
+		/// Remove the oldest row.
+		void removeOldest();
+
+		/// Clear all rows, keeps the capacity.
+		void clear();
+
+		/// Print the current rows to the console, oldest first.
+		void print() const;
+
+	/// \section File IO
+
+		/// Copy the current rows into a table, oldest first.
+		///
+		/// \param csv Table to load, clears any currently loaded data.
+		void toCsv(ofxCsv &csv) const;
+
+		/// Save the current rows to a CSV file, oldest first.
+		///
+		/// \param path File path to save.
+		/// \param quote Should the fields be double quoted? default false.
+		/// \param separator Field separator string, default comma ",".
+		/// \returns true if file saved successfully
+		bool save(const string &path, bool quote=false, const string &separator=",") const;
+
+	/// \section Raw Access
+
+		// iterator wrappers for easy looping, oldest to newest
+		iterator begin();
+		iterator end();
+		const_iterator begin() const;
+		const_iterator end() const;
+		std::reverse_iterator<iterator> rbegin();
+		std::reverse_iterator<iterator> rend();
+		std::reverse_iterator<const_iterator> rbegin() const;
+		std::reverse_iterator<const_iterator> rend() const;
+
+		/// Row access by index, 0 is the oldest row.
+		ofxCsvRow& operator[](size_t index);
+		const ofxCsvRow& operator[](size_t index) const;
+
+		/// Row access by index with bounds checking, 0 is the oldest row.
+		ofxCsvRow& at(size_t index);
+
+		/// Get the oldest row.
+		ofxCsvRow& front();
+
+		/// Get the newest row.
+		ofxCsvRow& back();
+
+		/// Alternate row size getter.
+		size_t size() const;
+
+		/// Is the table empty?
+		bool empty() const;
+
+	protected:
+
+		/// claim the slot for a new row, evicting the oldest row if full
+		ofxCsvRow& nextSlot();
+
+		/// ring buffer slot for a logical row index
+		size_t slot(size_t index) const;
+
+		vector<ofxCsvRow> rows; //< ring buffer storage, grows up to capacity
+		size_t capacity;        //< max number of rows
+		size_t head;            //< slot of the oldest row
+		size_t count;           //< current number of rows
+};
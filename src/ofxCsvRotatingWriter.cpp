@@ -0,0 +1,417 @@
+/**
+ *  ofxCsvRotatingWriter.cpp
+ *  Inspired and based on Ben Fry's [table class](http://benfry.com/writing/map/Table.pde)
+ *
+ *  The MIT License
+ *
+ *  Copyright (c) 2011-2019 Paul Vollmer, https://paulvollmer.net
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ *
+ *  @modified           2026.10.18
+ *  @version            0.2.1
+ */
+
+#include "ofxCsvRotatingWriter.h"
+
+#include "ofxCsv.h"
+#include "ofLog.h"
+#include "ofUtils.h"
+#include "ofFileUtils.h"
+
+#include <cstring>
+
+/// segment file buffer size
+static const size_t s_bufferSize = 64 * 1024;
+
+/// manifest & segment time stamp format
+static const string s_timeFormat = "%Y-%m-%d %H:%M:%S";
+
+//--------------------------------------------------
+ofxCsvRotatingWriter::ofxCsvRotatingWriter() {
+	fieldSeparator = ",";
+	maxSize = 0;
+	maxDuration = 0;
+	file = nullptr;
+	segmentBytes = 0;
+	segmentStart = 0;
+	segmentRows = 0;
+	fieldWritten = false;
+	stopping = false;
+}
+
+//--------------------------------------------------
+ofxCsvRotatingWriter::~ofxCsvRotatingWriter() {
+	close();
+}
+
+/// SETUP
+
+//--------------------------------------------------
+void ofxCsvRotatingWriter::setMaxSize(uint64_t bytes) {
+	maxSize = bytes;
+}
+
+//--------------------------------------------------
+void ofxCsvRotatingWriter::setMaxDuration(float seconds) {
+	maxDuration = seconds > 0 ? (uint64_t)(seconds * 1000) : 0;
+}
+
+//--------------------------------------------------
+void ofxCsvRotatingWriter::setHeader(const ofxCsvRow &header) {
+	this->header = header;
+}
+
+//--------------------------------------------------
+void ofxCsvRotatingWriter::setCompressor(Compressor compressor) {
+	std::lock_guard<std::mutex> lock(mutex);
+	this->compressor = compressor;
+}
+
+/// FILE IO
+
+//--------------------------------------------------
+bool ofxCsvRotatingWriter::open(const string &path, const string &separator) {
+	close();
+	filePath = path;
+	fieldSeparator = separator;
+
+	// create any required folders
+	string dir = ofFilePath::getEnclosingDirectory(ofToDataPath(filePath, true), false);
+	if(!dir.empty() && !ofDirectory::doesDirectoryExist(dir, false)) {
+		if(!ofDirectory::createDirectory(dir, false, true)) {
+			ofLogError("ofxCsvRotatingWriter") << "Cannot open " << filePath << ": couldn't create " << dir;
+			return false;
+		}
+	}
+
+	// continue after any existing segments
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		segments.clear();
+		loadManifest();
+	}
+	return openSegment();
+}
+
+//--------------------------------------------------
+bool ofxCsvRotatingWriter::addRow(const ofxCsvRow &row, bool quote) {
+	if(!beginRow()) {
+		return false;
+	}
+	for(auto &field : row) {
+		writeField(field.data(), field.size(), quote);
+	}
+	segmentRows++;
+	return endRow();
+}
+
+//--------------------------------------------------
+bool ofxCsvRotatingWriter::addRow(const vector<string> &fields, bool quote) {
+	return addRow(ofxCsvRow(fields), quote);
+}
+
+//--------------------------------------------------
+bool ofxCsvRotatingWriter::rotate() {
+	if(filePath.empty()) {
+		ofLogError("ofxCsvRotatingWriter") << "Cannot rotate: not opened";
+		return false;
+	}
+	closeSegment();
+	return openSegment();
+}
+
+//--------------------------------------------------
+void ofxCsvRotatingWriter::flush() {
+	if(file) {
+		fflush(file);
+	}
+}
+
+//--------------------------------------------------
+void ofxCsvRotatingWriter::close() {
+	closeSegment();
+	if(worker.joinable()) {
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			stopping = true;
+		}
+		condition.notify_all();
+		worker.join();
+		stopping = false;
+	}
+}
+
+/// UTIL
+
+//--------------------------------------------------
+bool ofxCsvRotatingWriter::isOpen() const {
+	return file != nullptr;
+}
+
+//--------------------------------------------------
+string ofxCsvRotatingWriter::getPath() const {
+	return filePath;
+}
+
+//--------------------------------------------------
+string ofxCsvRotatingWriter::getSegmentPath() const {
+	std::lock_guard<std::mutex> lock(mutex);
+	if(!file || segments.empty()) {
+		return "";
+	}
+	return ofFilePath::join(ofFilePath::getEnclosingDirectory(filePath, false), segments.back().file);
+}
+
+//--------------------------------------------------
+string ofxCsvRotatingWriter::getManifestPath() const {
+	string name = ofFilePath::removeExt(ofFilePath::getFileName(filePath)) + ".manifest.csv";
+	return ofFilePath::join(ofFilePath::getEnclosingDirectory(filePath, false), name);
+}
+
+//--------------------------------------------------
+size_t ofxCsvRotatingWriter::getNumSegments() const {
+	std::lock_guard<std::mutex> lock(mutex);
+	return segments.size();
+}
+
+//--------------------------------------------------
+size_t ofxCsvRotatingWriter::getNumSegmentRows() const {
+	return segmentRows;
+}
+
+// PROTECTED
+
+//--------------------------------------------------
+bool ofxCsvRotatingWriter::openSegment() {
+	Segment segment;
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		segment.file = segmentFile(segments.size());
+	}
+	segment.rows = 0;
+	segment.bytes = 0;
+	segment.start = ofGetTimestampString(s_timeFormat);
+	segment.compressed = false;
+
+	string path = ofFilePath::join(ofFilePath::getEnclosingDirectory(filePath, false), segment.file);
+	file = fopen(ofToDataPath(path, true).c_str(), "wb");
+	if(!file) {
+		ofLogError("ofxCsvRotatingWriter") << "Cannot open " << path << ": file not writable";
+		return false;
+	}
+	buffer.resize(s_bufferSize);
+	setvbuf(file, buffer.data(), _IOFBF, buffer.size());
+	segmentBytes = 0;
+	segmentRows = 0;
+	segmentStart = ofGetElapsedTimeMillis();
+	fieldWritten = false;
+	if(!header.empty()) {
+		for(auto &field : header) {
+			writeField(field.data(), field.size(), false);
+		}
+		fputc('\n', file);
+		segmentBytes++;
+		fieldWritten = false;
+	}
+
+	std::lock_guard<std::mutex> lock(mutex);
+	segments.push_back(segment);
+	saveManifest();
+	ofLogVerbose("ofxCsvRotatingWriter") << "Opened segment " << path;
+	return true;
+}
+
+//--------------------------------------------------
+void ofxCsvRotatingWriter::closeSegment() {
+	if(!file) {
+		return;
+	}
+	fclose(file);
+	file = nullptr;
+
+	std::lock_guard<std::mutex> lock(mutex);
+	Segment &segment = segments.back();
+	segment.rows = segmentRows;
+	segment.bytes = segmentBytes;
+	segment.end = ofGetTimestampString(s_timeFormat);
+	saveManifest();
+	ofLogVerbose("ofxCsvRotatingWriter") << "Closed segment " << segment.file << ": "
+		<< segment.rows << " rows, " << segment.bytes << " bytes";
+
+	// hand off to the compressor
+	if(compressor) {
+		compressQueue.push_back(segments.size()-1);
+		if(!worker.joinable()) {
+			worker = std::thread(&ofxCsvRotatingWriter::compressThread, this);
+		}
+		condition.notify_one();
+	}
+}
+
+//--------------------------------------------------
+bool ofxCsvRotatingWriter::beginRow() {
+	if(!file) {
+		ofLogError("ofxCsvRotatingWriter") << "Cannot add row: no open segment";
+		return false;
+	}
+	if(maxDuration > 0 && segmentRows > 0 &&
+	   ofGetElapsedTimeMillis() - segmentStart >= maxDuration) {
+		return rotate();
+	}
+	return true;
+}
+
+//--------------------------------------------------
+void ofxCsvRotatingWriter::writeField(const char *field, size_t size, bool quote) {
+	if(fieldWritten) {
+		fwrite(fieldSeparator.data(), 1, fieldSeparator.size(), file);
+		segmentBytes += fieldSeparator.size();
+	}
+	if(quote) { // double any quotes inside the field
+		fputc('"', file);
+		const char *end = field + size;
+		const char *found;
+		while((found = (const char *)memchr(field, '"', end - field)) != nullptr) {
+			fwrite(field, 1, found - field + 1, file);
+			fputc('"', file);
+			segmentBytes += found - field + 2;
+			field = found + 1;
+		}
+		fwrite(field, 1, end - field, file);
+		fputc('"', file);
+		segmentBytes += end - field + 2;
+	}
+	else {
+		fwrite(field, 1, size, file);
+		segmentBytes += size;
+	}
+	fieldWritten = true;
+}
+
+//--------------------------------------------------
+void ofxCsvRotatingWriter::writeValue(const string &value) {
+	writeField(value.data(), value.size(), false);
+}
+
+//--------------------------------------------------
+void ofxCsvRotatingWriter::writeValue(const char *value) {
+	writeField(value, value ? strlen(value) : 0, false);
+}
+
+//--------------------------------------------------
+bool ofxCsvRotatingWriter::endRow() {
+	fputc('\n', file);
+	segmentBytes++;
+	fieldWritten = false;
+	if(ferror(file)) {
+		ofLogError("ofxCsvRotatingWriter") << "Could not write to " << getSegmentPath();
+		return false;
+	}
+	if(maxSize > 0 && segmentBytes >= maxSize) {
+		return rotate();
+	}
+	return true;
+}
+
+//--------------------------------------------------
+void ofxCsvRotatingWriter::loadManifest() {
+	string path = ofToDataPath(getManifestPath(), true);
+	if(!ofFile::doesFileExist(path, false)) {
+		return;
+	}
+	ofxCsv manifest;
+	if(!manifest.load(path)) {
+		return;
+	}
+	for(size_t i = 1; i < manifest.size(); i++) { // skip header
+		const ofxCsvRow &row = manifest[i];
+		if(row.getString(0).empty()) {
+			continue;
+		}
+		Segment segment;
+		segment.file = row.getString(0);
+		segment.rows = (size_t)max(row.getInt64(1), (int64_t)0);
+		segment.bytes = (uint64_t)max(row.getInt64(2), (int64_t)0);
+		segment.start = row.getString(3);
+		segment.end = row.getString(4);
+		segment.compressed = row.getBool(5);
+		segments.push_back(segment);
+	}
+	ofLogVerbose("ofxCsvRotatingWriter") << "Continuing after " << segments.size() << " segments";
+}
+
+//--------------------------------------------------
+void ofxCsvRotatingWriter::saveManifest() {
+	ofxCsv manifest;
+	manifest.load(vector<vector<string>>{{"file", "rows", "bytes", "start", "end", "compressed"}});
+	for(auto &segment : segments) {
+		ofxCsvRow row;
+		row.addString(segment.file);
+		row.addString(ofToString(segment.rows));
+		row.addString(ofToString(segment.bytes));
+		row.addString(segment.start);
+		row.addString(segment.end);
+		row.addBool(segment.compressed);
+		manifest.addRow(row);
+	}
+	if(!manifest.save(ofToDataPath(getManifestPath(), true))) {
+		ofLogError("ofxCsvRotatingWriter") << "Could not save manifest " << getManifestPath();
+	}
+}
+
+//--------------------------------------------------
+void ofxCsvRotatingWriter::compressThread() {
+	std::unique_lock<std::mutex> lock(mutex);
+	while(true) {
+		condition.wait(lock, [this] {return stopping || !compressQueue.empty();});
+		if(compressQueue.empty()) { // stopping & nothing left to do
+			break;
+		}
+		size_t index = compressQueue.front();
+		compressQueue.pop_front();
+		Compressor compress = compressor;
+		string dir = ofFilePath::getEnclosingDirectory(ofToDataPath(filePath, true), false);
+		string path = ofFilePath::join(dir, segments[index].file);
+
+		// compress without holding the lock so writing is never blocked
+		lock.unlock();
+		string compressed = compress ? compress(path) : "";
+		uint64_t bytes = compressed.empty() ? 0 : ofFile(compressed, ofFile::Reference).getSize();
+		lock.lock();
+
+		if(compressed.empty()) {
+			ofLogWarning("ofxCsvRotatingWriter") << "Could not compress " << path;
+			continue;
+		}
+		segments[index].file = ofFilePath::getFileName(compressed);
+		segments[index].bytes = bytes;
+		segments[index].compressed = true;
+		saveManifest();
+	}
+}
+
+//--------------------------------------------------
+string ofxCsvRotatingWriter::segmentFile(size_t number) const {
+	string name = ofFilePath::getFileName(filePath);
+	string ext = ofFilePath::getFileExt(name);
+	char num[32];
+	snprintf(num, sizeof(num), ".%04zu.", number);
+	return ofFilePath::removeExt(name) + num + (ext.empty() ? "csv" : ext);
+}
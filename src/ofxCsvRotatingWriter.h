@@ -0,0 +1,261 @@
+/**
+ *  ofxCsvRotatingWriter.h
+ *  Inspired and based on Ben Fry's [table class](http://benfry.com/writing/map/Table.pde)
+ *
+ *  The MIT License
+ *
+ *  Copyright (c) 2011-2019 Paul Vollmer, https://paulvollmer.net
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ *
+ *  @modified           2026.10.18
+ *  @version            0.2.1
+ */
+
+#pragma once
+
+#include "ofxCsvRow.h"
+#include "ofxCsvFormat.h"
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+/// \class ofxCsvRotatingWriter
+/// \brief appends rows to a series of CSV segment files for long recordings
+///
+/// Instead of saving a whole table, rows are appended to the current segment
+/// through a buffered file & the writer rolls over to a new segment when it
+/// reaches a size or time limit, so write latency stays flat however long
+/// the session runs:
+///
+///     ofxCsvRotatingWriter recorder;
+///     recorder.setMaxSize(64 * 1024 * 1024); // 64 MB
+///     recorder.setMaxDuration(60 * 60);      // or 1 hour
+///     recorder.open("recordings/mouse.csv"); // mouse.0000.csv, mouse.0001.csv, ...
+///     ...
+///     recorder.addRow(row);
+///
+/// A manifest, ie. mouse.manifest.csv, lists the segments with their row
+/// counts, sizes, & start/end times. Opening the same base path again
+/// continues after the segments in an existing manifest.
+///
+/// Closed segments can optionally be handed to a compressor which is run on
+/// a background thread:
+///
+///     recorder.setCompressor([](const string &path) {
+///         // compress path, ie. to path + ".gz", & remove the original
+///         return path + ".gz"; // new path or "" on failure
+///     });
+///
+class ofxCsvRotatingWriter {
+
+	public:
+
+		/// Compressor function, given the absolute path of a closed segment.
+		/// Returns the absolute path of the compressed segment or "" on
+		/// failure.
+		typedef std::function<string(const string &path)> Compressor;
+
+		/// Constructor. Initializes and starts the class.
+		ofxCsvRotatingWriter();
+
+		/// Destructor. Closes the current segment & waits for any pending
+		/// compression.
+		virtual ~ofxCsvRotatingWriter();
+
+	/// \section Setup
+
+		/// Set the segment size limit in bytes, 0 for no limit.
+		void setMaxSize(uint64_t bytes);
+
+		/// Set the segment duration limit in seconds, 0 for no limit.
+		void setMaxDuration(float seconds);
+
+		/// Set a header row written at the top of each segment.
+		void setHeader(const ofxCsvRow &header);
+
+		/// Set the compressor for closed segments, nullptr for none.
+		void setCompressor(Compressor compressor);
+
+	/// \section File IO
+
+		/// Open a new segment for writing.
+		///
+		/// Closes any currently open segment. Creates any required folders
+		/// in the path, if needed.
+		///
+		/// \param path Base file path, segments are numbered before the
+		///             extension: path.0000.csv, path.0001.csv, ...
+		/// \param separator Field separator string, default comma ",".
+		/// \returns true if the segment was opened successfully
+		bool open(const string &path, const string &separator=",");
+
+		/// Append a row to the current segment, rotating first if a limit
+		/// has been reached.
+		///
+		/// \param row Row to append.
+		/// \param quote Should the fields be double quoted? default false.
+		/// \returns true if the row was written successfully
+		bool addRow(const ofxCsvRow &row, bool quote=false);
+
+		/// Append a row of fields to the current segment, rotating first if a
+		/// limit has been reached.
+		///
+		/// \param fields Fields to append.
+		/// \param quote Should the fields be double quoted? default false.
+		/// \returns true if the row was written successfully
+		bool addRow(const vector<string> &fields, bool quote=false);
+
+		/// Append a row of values to the current segment, rotating first if
+		/// a limit has been reached.
+		///
+		/// Each value is formatted straight into the file buffer without
+		/// building an intermediate ofxCsvRow, ie.
+		///
+		///     recorder.appendRow(x, y, 1.5f, "label");
+		///
+		/// Numbers are written with enough digits to parse back to the same
+		/// value, see ofxCsvFormat::appendExact(), strings are written as is.
+		///
+		/// \param values Field values: numbers, bools, strings, or C strings.
+		/// \returns true if the row was written successfully
+		template<typename... Values>
+		bool appendRow(const Values&... values);
+
+		/// Close the current segment & start the next one.
+		/// \returns true if the next segment was opened successfully
+		bool rotate();
+
+		/// Flush buffered rows to the current segment file.
+		void flush();
+
+		/// Close the current segment.
+		///
+		/// Waits for any pending compression to finish.
+		void close();
+
+	/// \section Util
+
+		/// Is a segment currently open?
+		bool isOpen() const;
+
+		/// Get the base file path.
+		string getPath() const;
+
+		/// Get the current segment file path.
+		string getSegmentPath() const;
+
+		/// Get the manifest file path.
+		string getManifestPath() const;
+
+		/// Get the number of segments, including the current segment.
+		size_t getNumSegments() const;
+
+		/// Get the number of rows written to the current segment.
+		size_t getNumSegmentRows() const;
+
+	protected:
+
+		/// manifest entry for a single segment
+		struct Segment {
+			string file;       //< file name, relative to the manifest
+			size_t rows;       //< number of data rows
+			uint64_t bytes;    //< file size in bytes
+			string start;      //< start time stamp
+			string end;        //< end time stamp, empty while recording
+			bool compressed;   //< has the file been compressed?
+		};
+
+		/// open the next numbered segment
+		bool openSegment();
+
+		/// close the current segment, queueing it for compression
+		void closeSegment();
+
+		/// check for an open segment & rotate if the time limit was reached
+		bool beginRow();
+
+		/// write a field to the current segment
+		void writeField(const char *field, size_t size, bool quote);
+
+		/// write a value field to the current segment without quotes
+		void writeValue(const string &value);
+		void writeValue(const char *value);
+		template<typename T>
+		typename std::enable_if<std::is_arithmetic<T>::value>::type writeValue(T value);
+
+		/// finish writing a row & check the size limit
+		bool endRow();
+
+		/// read segments from an existing manifest
+		void loadManifest();
+
+		/// write the manifest, call with the mutex locked
+		void saveManifest();
+
+		/// background compression loop
+		void compressThread();
+
+		/// segment file name for a segment number
+		string segmentFile(size_t number) const;
+
+		string filePath;        //< base file path
+		string fieldSeparator;  //< field separator, default: comma ","
+		ofxCsvRow header;       //< header row written to each segment
+		uint64_t maxSize;       //< segment size limit in bytes, 0 for none
+		uint64_t maxDuration;   //< segment duration limit in ms, 0 for none
+
+		FILE *file;             //< current segment file
+		vector<char> buffer;    //< current segment file buffer
+		uint64_t segmentBytes;  //< bytes written to the current segment
+		uint64_t segmentStart;  //< current segment start time in ms
+		size_t segmentRows;     //< rows written to the current segment
+		bool fieldWritten;      //< has a field been written to the current row?
+
+		mutable std::mutex mutex;           //< guards segments & the compress queue
+		vector<Segment> segments;           //< manifest entries
+		Compressor compressor;              //< compressor, may be empty
+		std::deque<size_t> compressQueue;   //< segments waiting for compression
+		std::thread worker;                 //< compression thread
+		std::condition_variable condition;  //< wakes the compression thread
+		bool stopping;                      //< stop the compression thread?
+};
+
+// TEMPLATES
+
+//--------------------------------------------------
+template<typename... Values>
+bool ofxCsvRotatingWriter::appendRow(const Values&... values) {
+	if(!beginRow()) {
+		return false;
+	}
+	int unpack[] = {0, (writeValue(values), 0)...};
+	(void)unpack;
+	segmentRows++;
+	return endRow();
+}
+
+//--------------------------------------------------
+template<typename T>
+typename std::enable_if<std::is_arithmetic<T>::value>::type
+ofxCsvRotatingWriter::writeValue(T value) {
+	char buf[ofxCsvFormat::bufferSize];
+	writeField(buf, ofxCsvFormat::toCharsExact(buf, value), false);
+}
@@ -29,6 +29,8 @@
  */
 
 #include "ofxCsvRow.h"
+#include "ofxCsvFormat.h"
+#include "ofxCsvParse.h"
 
 #include "ofLog.h"
 #include "ofUtils.h"
@@ -113,18 +115,47 @@ unsigned int ofxCsvRow::getNumCols() const {
 
 //--------------------------------------------------
 int ofxCsvRow::getInt(int col) const {
+	return getInt(col, ofxCsvNumberFormat());
+}
+
+//--------------------------------------------------
+int64_t ofxCsvRow::getInt64(int col) const {
+	return getInt64(col, ofxCsvNumberFormat());
+}
+
+//--------------------------------------------------
+float ofxCsvRow::getFloat(int col) const {
+	return getFloat(col, ofxCsvNumberFormat());
+}
+
+//--------------------------------------------------
+int ofxCsvRow::getInt(int col, const ofxCsvNumberFormat &format) const {
 	if(col >= data.size()) {
 		return 0;
 	}
-	return ofToInt(data[col]);
+	int v = 0;
+	ofxCsvParse::toInteger(data[col].data(), data[col].data() + data[col].size(), v, nullptr, format);
+	return v;
 }
 
 //--------------------------------------------------
-float ofxCsvRow::getFloat(int col) const {
+int64_t ofxCsvRow::getInt64(int col, const ofxCsvNumberFormat &format) const {
+	if(col >= data.size()) {
+		return 0;
+	}
+	int64_t v = 0;
+	ofxCsvParse::toInt64(data[col].data(), data[col].data() + data[col].size(), v, format);
+	return v;
+}
+
+//--------------------------------------------------
+float ofxCsvRow::getFloat(int col, const ofxCsvNumberFormat &format) const {
 	if(col >= data.size()) {
 		return 0.0f;
 	}
-	return ofToFloat(data[col]);
+	float v = 0;
+	ofxCsvParse::toFloat(data[col].data(), data[col].data() + data[col].size(), v, format);
+	return v;
 }
 
 //--------------------------------------------------
@@ -147,12 +178,12 @@ bool ofxCsvRow::getBool(int col) const {
 
 //--------------------------------------------------
 void ofxCsvRow::addInt(int what) {
-	data.push_back(ofToString(what));
+	data.push_back(ofxCsvFormat::toString(what));
 }
 
 //--------------------------------------------------
 void ofxCsvRow::addFloat(float what) {
-	data.push_back(ofToString(what));
+	data.push_back(ofxCsvFormat::toString(what));
 }
 
 //--------------------------------------------------
@@ -162,20 +193,22 @@ void ofxCsvRow::addString(string what) {
 
 //--------------------------------------------------
 void ofxCsvRow::ofxCsvRow::addBool(bool what) {
-	data.push_back(ofToString(what));
+	data.push_back(ofxCsvFormat::toString(what));
 }
 // SETTING FIELDS
 
 //--------------------------------------------------
 void ofxCsvRow::setInt(int col, int what) {
 	expand(col);
-	data[col] = ofToString(what);
+	data[col].clear();
+	ofxCsvFormat::append(data[col], what);
 }
 
 //--------------------------------------------------
 void ofxCsvRow::setFloat(int col, float what) {
 	expand(col);
-	data[col] = ofToString(what);
+	data[col].clear();
+	ofxCsvFormat::append(data[col], what);
 }
 
 //--------------------------------------------------
@@ -187,7 +220,8 @@ void ofxCsvRow::setString(int col, string what) {
 //--------------------------------------------------
 void ofxCsvRow::setBool(int col, bool what) {
 	expand(col);
-	data[col] = ofToString(what);
+	data[col].clear();
+	ofxCsvFormat::append(data[col], what);
 }
 
 // INSERTING FIELDS
@@ -195,13 +229,13 @@ void ofxCsvRow::setBool(int col, bool what) {
 //--------------------------------------------------
 void ofxCsvRow::insertInt(int col, int what) {
 	expand(col);
-	data.insert(data.begin()+col, ofToString(what));
+	data.insert(data.begin()+col, ofxCsvFormat::toString(what));
 }
 
 //--------------------------------------------------
 void ofxCsvRow::insertFloat(int col, float what) {
 	expand(col);
-	data.insert(data.begin()+col, ofToString(what));
+	data.insert(data.begin()+col, ofxCsvFormat::toString(what));
 }
 
 //--------------------------------------------------
@@ -213,7 +247,7 @@ void ofxCsvRow::insertString(int col, string what) {
 //--------------------------------------------------
 void ofxCsvRow::insertBool(int col, bool what) {
 	expand(col);
-	data.insert(data.begin()+col, ofToString(what));
+	data.insert(data.begin()+col, ofxCsvFormat::toString(what));
 }
 
 // REMOVING FIELDS
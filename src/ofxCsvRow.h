@@ -33,6 +33,8 @@ using namespace std;
 
 #include "ofConstants.h"
 
+struct ofxCsvNumberFormat;
+
 /// \class ofxCsvRow
 /// \brief A single row of column fields.
 class ofxCsvRow {
@@ -100,16 +102,54 @@ class ofxCsvRow {
 	
 		/// Get a field as an integer value.
 		///
+		/// Reads "0x" hex & "0b" binary values, values outside the int range
+		/// are clamped.
+		///
 		/// \param col Column number
 		/// \returns the value or 0 if not found.
 		int getInt(int col) const;
+
+		/// Get a field as a 64 bit integer value, ie. for large ids.
+		///
+		/// Reads "0x" hex & "0b" binary values, values outside the int64_t
+		/// range are clamped.
+		///
+		/// \param col Column number
+		/// \returns the value or 0 if not found.
+		int64_t getInt64(int col) const;
 	
 		/// Get a field as a float value.
 		///
+		/// Always uses a '.' decimal point, whatever the process locale.
+		///
 		/// \param col Column number
 		/// \returns the value or 0.0 if not found.
 		float getFloat(int col) const;
 	
+		/// Get a field as an integer value using a number format,
+		/// ie. "1.234" with ofxCsvNumberFormat(',', '.').
+		///
+		/// \param col Column number
+		/// \param format Decimal mark & thousands separator.
+		/// \returns the value or 0 if not found.
+		int getInt(int col, const ofxCsvNumberFormat &format) const;
+
+		/// Get a field as a 64 bit integer value using a number format,
+		/// ie. "1.234.567" with ofxCsvNumberFormat(',', '.').
+		///
+		/// \param col Column number
+		/// \param format Decimal mark & thousands separator.
+		/// \returns the value or 0 if not found.
+		int64_t getInt64(int col, const ofxCsvNumberFormat &format) const;
+	
+		/// Get a field as a float value using a number format,
+		/// ie. "1.234,5" with ofxCsvNumberFormat(',', '.').
+		///
+		/// \param col Column number
+		/// \param format Decimal mark & thousands separator.
+		/// \returns the value or 0.0 if not found.
+		float getFloat(int col, const ofxCsvNumberFormat &format) const;
+	
 		/// Get a field as a string value.
 		///
 		/// \param col Column number
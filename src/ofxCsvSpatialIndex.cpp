@@ -0,0 +1,401 @@
+/**
+ *  ofxCsvSpatialIndex.cpp
+ *  Inspired and based on Ben Fry's [table class](http://benfry.com/writing/map/Table.pde)
+ *
+ *  The MIT License
+ *
+ *  Copyright (c) 2011-2019 Paul Vollmer, https://paulvollmer.net
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ *
+ *  @modified           2026.10.18
+ *  @version            0.2.1
+ */
+
+#include "ofxCsvSpatialIndex.h"
+
+#include "ofLog.h"
+
+#include <queue>
+
+/// max number of grid cells, limits memory use for tiny cell sizes
+static const size_t s_maxCells = 1 << 24;
+
+//--------------------------------------------------
+ofxCsvSpatialIndex::ofxCsvSpatialIndex() {
+	clear();
+}
+
+/// BUILDING
+
+//--------------------------------------------------
+bool ofxCsvSpatialIndex::build2D(const ofxCsv &csv, int xCol, int yCol, int firstRow, float cellSize) {
+	int cols[2] = {xCol, yCol};
+	return build(csv, cols, 2, firstRow, cellSize);
+}
+
+//--------------------------------------------------
+bool ofxCsvSpatialIndex::build3D(const ofxCsv &csv, int xCol, int yCol, int zCol, int firstRow, float cellSize) {
+	int cols[3] = {xCol, yCol, zCol};
+	return build(csv, cols, 3, firstRow, cellSize);
+}
+
+//--------------------------------------------------
+void ofxCsvSpatialIndex::clear() {
+	dimensions = 0;
+	cellSize = 1;
+	invCellSize = 1;
+	for(int a = 0; a < 3; a++) {
+		origin[a] = 0;
+		cells[a] = 1;
+		coords[a].clear();
+	}
+	rows.clear();
+	cellStart.clear();
+}
+
+/// QUERIES
+
+//--------------------------------------------------
+vector<size_t> ofxCsvSpatialIndex::findInRadius(float x, float y, float radius) const {
+	vector<size_t> found;
+	if(dimensions != 2) {
+		return found;
+	}
+	int lo[3] = {cellCoord(x-radius, 0), cellCoord(y-radius, 1), 0};
+	int hi[3] = {cellCoord(x+radius, 0), cellCoord(y+radius, 1), 0};
+	float r2 = radius*radius;
+	const float *xs = coords[0].data(), *ys = coords[1].data();
+	visitCells(lo, hi, [&](size_t p) {
+		float dx = xs[p]-x, dy = ys[p]-y;
+		if(dx*dx + dy*dy <= r2) {
+			found.push_back(rows[p]);
+		}
+	});
+	return found;
+}
+
+//--------------------------------------------------
+vector<size_t> ofxCsvSpatialIndex::findInRadius(float x, float y, float z, float radius) const {
+	vector<size_t> found;
+	if(dimensions != 3) {
+		return found;
+	}
+	int lo[3] = {cellCoord(x-radius, 0), cellCoord(y-radius, 1), cellCoord(z-radius, 2)};
+	int hi[3] = {cellCoord(x+radius, 0), cellCoord(y+radius, 1), cellCoord(z+radius, 2)};
+	float r2 = radius*radius;
+	const float *xs = coords[0].data(), *ys = coords[1].data(), *zs = coords[2].data();
+	visitCells(lo, hi, [&](size_t p) {
+		float dx = xs[p]-x, dy = ys[p]-y, dz = zs[p]-z;
+		if(dx*dx + dy*dy + dz*dz <= r2) {
+			found.push_back(rows[p]);
+		}
+	});
+	return found;
+}
+
+//--------------------------------------------------
+vector<size_t> ofxCsvSpatialIndex::findInRect(float minX, float minY, float maxX, float maxY) const {
+	vector<size_t> found;
+	if(dimensions != 2 || minX > maxX || minY > maxY) {
+		return found;
+	}
+	int lo[3] = {cellCoord(minX, 0), cellCoord(minY, 1), 0};
+	int hi[3] = {cellCoord(maxX, 0), cellCoord(maxY, 1), 0};
+	const float *xs = coords[0].data(), *ys = coords[1].data();
+	visitCells(lo, hi, [&](size_t p) {
+		if(xs[p] >= minX && xs[p] <= maxX && ys[p] >= minY && ys[p] <= maxY) {
+			found.push_back(rows[p]);
+		}
+	});
+	return found;
+}
+
+//--------------------------------------------------
+vector<size_t> ofxCsvSpatialIndex::findInBox(float minX, float minY, float minZ,
+                                             float maxX, float maxY, float maxZ) const {
+	vector<size_t> found;
+	if(dimensions != 3 || minX > maxX || minY > maxY || minZ > maxZ) {
+		return found;
+	}
+	int lo[3] = {cellCoord(minX, 0), cellCoord(minY, 1), cellCoord(minZ, 2)};
+	int hi[3] = {cellCoord(maxX, 0), cellCoord(maxY, 1), cellCoord(maxZ, 2)};
+	const float *xs = coords[0].data(), *ys = coords[1].data(), *zs = coords[2].data();
+	visitCells(lo, hi, [&](size_t p) {
+		if(xs[p] >= minX && xs[p] <= maxX &&
+		   ys[p] >= minY && ys[p] <= maxY &&
+		   zs[p] >= minZ && zs[p] <= maxZ) {
+			found.push_back(rows[p]);
+		}
+	});
+	return found;
+}
+
+//--------------------------------------------------
+vector<size_t> ofxCsvSpatialIndex::findNearest2D(float x, float y, size_t k) const {
+	if(dimensions != 2) {
+		return vector<size_t>();
+	}
+	float p[3] = {x, y, 0};
+	return findNearest(p, k);
+}
+
+//--------------------------------------------------
+vector<size_t> ofxCsvSpatialIndex::findNearest3D(float x, float y, float z, size_t k) const {
+	if(dimensions != 3) {
+		return vector<size_t>();
+	}
+	float p[3] = {x, y, z};
+	return findNearest(p, k);
+}
+
+/// UTIL
+
+//--------------------------------------------------
+size_t ofxCsvSpatialIndex::getNumPoints() const {
+	return rows.size();
+}
+
+//--------------------------------------------------
+int ofxCsvSpatialIndex::getDimensions() const {
+	return dimensions;
+}
+
+//--------------------------------------------------
+float ofxCsvSpatialIndex::getCellSize() const {
+	return cellSize;
+}
+
+//--------------------------------------------------
+bool ofxCsvSpatialIndex::empty() const {
+	return rows.empty();
+}
+
+// PROTECTED
+
+//--------------------------------------------------
+bool ofxCsvSpatialIndex::build(const ofxCsv &csv, const int *cols, int dims, int firstRow, float size) {
+
+	clear();
+
+	// gather points, skipping rows without the required cols
+	int maxCol = 0;
+	for(int a = 0; a < dims; a++) {
+		if(cols[a] < 0) {
+			ofLogError("ofxCsvSpatialIndex") << "Cannot build index: invalid col " << cols[a];
+			return false;
+		}
+		maxCol = max(maxCol, cols[a]);
+	}
+	vector<float> points[3];
+	vector<size_t> pointRows;
+	ofxCsvNumberFormat format = csv.getNumberFormat();
+	size_t index = 0;
+	for(auto &row : csv) {
+		if(index >= (size_t)max(firstRow, 0) && row.size() > (size_t)maxCol) {
+			for(int a = 0; a < dims; a++) {
+				points[a].push_back(row.getFloat(cols[a], format));
+			}
+			pointRows.push_back(index);
+		}
+		index++;
+	}
+	if(pointRows.empty()) {
+		ofLogWarning("ofxCsvSpatialIndex") << "Nothing to index";
+		return false;
+	}
+	dimensions = dims;
+
+	// bounds
+	float extent[3] = {0, 0, 0};
+	for(int a = 0; a < dims; a++) {
+		auto bounds = std::minmax_element(points[a].begin(), points[a].end());
+		origin[a] = *bounds.first;
+		extent[a] = *bounds.second - *bounds.first;
+	}
+
+	// cell size for ~2 points per cell over the bounding volume, ignoring
+	// flat axes
+	if(size <= 0) {
+		double volume = 1;
+		int spanned = 0;
+		for(int a = 0; a < dims; a++) {
+			if(extent[a] > 0) {
+				volume *= extent[a];
+				spanned++;
+			}
+		}
+		if(spanned == 0) {
+			size = 1;
+		}
+		else {
+			double targetCells = max(pointRows.size() / 2.0, 1.0);
+			size = (float)pow(volume / targetCells, 1.0 / spanned);
+		}
+	}
+
+	// grow the cell size until the grid fits the cell budget
+	size_t numCells = 0;
+	while(true) {
+		numCells = 1;
+		for(int a = 0; a < dims; a++) {
+			cells[a] = (int)min(extent[a] / size, (float)s_maxCells) + 1;
+			numCells *= cells[a];
+		}
+		if(numCells <= s_maxCells) {
+			break;
+		}
+		size *= 2;
+	}
+	cellSize = size;
+	invCellSize = 1.0f / size;
+
+	// counting sort points by cell so each cell's points are contiguous
+	vector<size_t> pointCells(pointRows.size());
+	cellStart.assign(numCells+1, 0);
+	for(size_t p = 0; p < pointRows.size(); p++) {
+		size_t cell = 0;
+		for(int a = dims-1; a >= 0; a--) {
+			cell = cell * cells[a] + cellCoord(points[a][p], a);
+		}
+		pointCells[p] = cell;
+		cellStart[cell+1]++;
+	}
+	for(size_t c = 0; c < numCells; c++) {
+		cellStart[c+1] += cellStart[c];
+	}
+	vector<size_t> next(cellStart.begin(), cellStart.end()-1);
+	for(int a = 0; a < dims; a++) {
+		coords[a].resize(pointRows.size());
+	}
+	rows.resize(pointRows.size());
+	for(size_t p = 0; p < pointRows.size(); p++) {
+		size_t dest = next[pointCells[p]]++;
+		for(int a = 0; a < dims; a++) {
+			coords[a][dest] = points[a][p];
+		}
+		rows[dest] = pointRows[p];
+	}
+
+	ofLogVerbose("ofxCsvSpatialIndex") << "Indexed " << rows.size() << " points in "
+		<< numCells << " cells of size " << cellSize;
+
+	return true;
+}
+
+//--------------------------------------------------
+int ofxCsvSpatialIndex::cellCoord(float v, int axis) const {
+	float c = (v - origin[axis]) * invCellSize;
+	if(!(c > 0)) { // also catches NaN
+		return 0;
+	}
+	if(c >= cells[axis]) {
+		return cells[axis]-1;
+	}
+	return (int)c;
+}
+
+//--------------------------------------------------
+template<typename F>
+void ofxCsvSpatialIndex::visitCells(const int *lo, const int *hi, F &&visit) const {
+	for(int z = lo[2]; z <= hi[2]; z++) {
+		for(int y = lo[1]; y <= hi[1]; y++) {
+			// cells along x are contiguous, visit the whole span at once
+			size_t rowCell = ((size_t)z * cells[1] + y) * cells[0];
+			size_t end = cellStart[rowCell + hi[0] + 1];
+			for(size_t p = cellStart[rowCell + lo[0]]; p < end; p++) {
+				visit(p);
+			}
+		}
+	}
+}
+
+//--------------------------------------------------
+vector<size_t> ofxCsvSpatialIndex::findNearest(const float *p, size_t k) const {
+
+	vector<size_t> found;
+	if(k == 0 || rows.empty()) {
+		return found;
+	}
+	k = min(k, rows.size());
+
+	// max heap of (squared distance, point) holding the k best so far
+	typedef pair<float, size_t> Candidate;
+	priority_queue<Candidate> best;
+
+	int center[3] = {0, 0, 0};
+	int maxRing = 0;
+	for(int a = 0; a < dimensions; a++) {
+		center[a] = cellCoord(p[a], a);
+		maxRing = max(maxRing, max(center[a], cells[a]-1-center[a]));
+	}
+
+	for(int ring = 0; ring <= maxRing; ring++) {
+
+		// visit the shell of cells at exactly this ring distance
+		int lo[3] = {0, 0, 0}, hi[3] = {0, 0, 0};
+		for(int a = 0; a < dimensions; a++) {
+			lo[a] = max(center[a]-ring, 0);
+			hi[a] = min(center[a]+ring, cells[a]-1);
+		}
+		for(int z = lo[2]; z <= hi[2]; z++) {
+			bool zEdge = (dimensions == 3 && abs(z-center[2]) == ring);
+			for(int y = lo[1]; y <= hi[1]; y++) {
+				bool yEdge = zEdge || abs(y-center[1]) == ring;
+				// interior rows only touch the two x ends of the shell
+				int step = yEdge ? 1 : max(2*ring, 1);
+				for(int x = center[0]-ring; x <= center[0]+ring; x += step) {
+					if(x < lo[0] || x > hi[0]) {
+						continue;
+					}
+					size_t cell = ((size_t)z * cells[1] + y) * cells[0] + x;
+					for(size_t i = cellStart[cell]; i < cellStart[cell+1]; i++) {
+						float d2 = 0;
+						for(int a = 0; a < dimensions; a++) {
+							float d = coords[a][i] - p[a];
+							d2 += d*d;
+						}
+						if(best.size() < k) {
+							best.push(Candidate(d2, i));
+						}
+						else if(d2 < best.top().first) {
+							best.pop();
+							best.push(Candidate(d2, i));
+						}
+					}
+				}
+			}
+		}
+
+		// any point outside this ring is at least ring * cellSize away
+		if(best.size() == k) {
+			float bound = ring * cellSize;
+			if(best.top().first <= bound*bound) {
+				break;
+			}
+		}
+	}
+
+	found.resize(best.size());
+	for(size_t i = found.size(); i > 0; i--) {
+		found[i-1] = rows[best.top().second];
+		best.pop();
+	}
+	return found;
+}
@@ -0,0 +1,165 @@
+/**
+ *  ofxCsvSpatialIndex.h
+ *  Inspired and based on Ben Fry's [table class](http://benfry.com/writing/map/Table.pde)
+ *
+ *  The MIT License
+ *
+ *  Copyright (c) 2011-2019 Paul Vollmer, https://paulvollmer.net
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ *
+ *  @modified           2026.10.18
+ *  @version            0.2.1
+ */
+
+#pragma once
+
+#include "ofxCsv.h"
+
+/// \class ofxCsvSpatialIndex
+/// \brief uniform grid index over 2 or 3 numeric columns of an ofxCsv
+///
+/// Answers radius, rectangle/box & k nearest neighbor queries without
+/// scanning every row, ie. for recorded mouse or tracking data:
+///
+///     ofxCsvSpatialIndex index;
+///     index.build2D(csvRecorder, 0, 1); // x & y cols
+///     for(auto i : index.findInRadius(mouseX, mouseY, 20)) {
+///         ofxCsvRow &row = csvRecorder[i];
+///     }
+///
+/// Query results are row indices into the indexed table. The index is a
+/// snapshot, rebuild it after modifying the table.
+///
+/// Notes:
+///   * Points are bucketed into grid cells & stored contiguously per cell.
+///   * The cell size is chosen for roughly 2 points per cell by default.
+///   * Rows without the required cols are not indexed.
+///
+class ofxCsvSpatialIndex {
+
+	public:
+
+		/// Constructor. Initializes and starts the class.
+		ofxCsvSpatialIndex();
+
+	/// \section Building
+
+		/// Build a 2D index from x & y cols.
+		///
+		/// Clears any current index data.
+		///
+		/// \param csv Table to index.
+		/// \param xCol X coordinate col.
+		/// \param yCol Y coordinate col.
+		/// \param firstRow First row to index, ie. 1 to skip a header row.
+		/// \param cellSize Grid cell size, calculated from the data when <= 0.
+		/// \returns true if any points were indexed
+		bool build2D(const ofxCsv &csv, int xCol, int yCol, int firstRow=0, float cellSize=0);
+
+		/// Build a 3D index from x, y, & z cols.
+		///
+		/// Clears any current index data.
+		///
+		/// \param csv Table to index.
+		/// \param xCol X coordinate col.
+		/// \param yCol Y coordinate col.
+		/// \param zCol Z coordinate col.
+		/// \param firstRow First row to index, ie. 1 to skip a header row.
+		/// \param cellSize Grid cell size, calculated from the data when <= 0.
+		/// \returns true if any points were indexed
+		bool build3D(const ofxCsv &csv, int xCol, int yCol, int zCol, int firstRow=0, float cellSize=0);
+
+		/// Clear the current index data.
+		void clear();
+
+	/// \section Queries
+
+		/// Find all points within a radius of a 2D position.
+		///
+		/// \returns row indices in no particular order
+		vector<size_t> findInRadius(float x, float y, float radius) const;
+
+		/// Find all points within a radius of a 3D position.
+		///
+		/// \returns row indices in no particular order
+		vector<size_t> findInRadius(float x, float y, float z, float radius) const;
+
+		/// Find all points inside a 2D rectangle, bounds inclusive.
+		///
+		/// \returns row indices in no particular order
+		vector<size_t> findInRect(float minX, float minY, float maxX, float maxY) const;
+
+		/// Find all points inside a 3D box, bounds inclusive.
+		///
+		/// \returns row indices in no particular order
+		vector<size_t> findInBox(float minX, float minY, float minZ,
+		                         float maxX, float maxY, float maxZ) const;
+
+		/// Find the k nearest points to a 2D position.
+		///
+		/// Named apart from findNearest3D() so a 3D call can't silently
+		/// pass z as k.
+		///
+		/// \returns row indices sorted by distance, nearest first
+		vector<size_t> findNearest2D(float x, float y, size_t k=1) const;
+
+		/// Find the k nearest points to a 3D position.
+		///
+		/// \returns row indices sorted by distance, nearest first
+		vector<size_t> findNearest3D(float x, float y, float z, size_t k=1) const;
+
+	/// \section Util
+
+		/// Get the number of indexed points.
+		size_t getNumPoints() const;
+
+		/// Get the number of indexed dimensions: 2, 3, or 0 if not built.
+		int getDimensions() const;
+
+		/// Get the current grid cell size.
+		float getCellSize() const;
+
+		/// Is the index empty?
+		bool empty() const;
+
+	protected:
+
+		/// index points from the given cols
+		bool build(const ofxCsv &csv, const int *cols, int dims, int firstRow, float cellSize);
+
+		/// grid cell coordinate for a position along an axis, clamped to the grid
+		int cellCoord(float v, int axis) const;
+
+		/// visit all points in a range of cells, inclusive
+		template<typename F>
+		void visitCells(const int *lo, const int *hi, F &&visit) const;
+
+		/// k nearest neighbor search in growing rings of cells
+		vector<size_t> findNearest(const float *p, size_t k) const;
+
+		int dimensions;                 //< number of dimensions, 2 or 3
+		float cellSize;                 //< grid cell size
+		float invCellSize;              //< 1 / cellSize
+		float origin[3];                //< grid minimum corner
+		int cells[3];                   //< number of cells per axis
+		vector<float> coords[3];        //< point coords, sorted by cell
+		vector<size_t> rows;            //< point row indices, sorted by cell
+		vector<size_t> cellStart;       //< first point index per cell, size = numCells+1
+};
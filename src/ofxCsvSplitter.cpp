@@ -0,0 +1,323 @@
+/**
+ *  ofxCsvSplitter.cpp
+ *  Inspired and based on Ben Fry's [table class](http://benfry.com/writing/map/Table.pde)
+ *
+ *  The MIT License
+ *
+ *  Copyright (c) 2011-2019 Paul Vollmer, https://paulvollmer.net
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ *
+ *  @modified           2026.10.18
+ *  @version            0.2.1
+ */
+
+#include "ofxCsvSplitter.h"
+
+#include "ofxCsvParse.h"
+#include "ofLog.h"
+#include "ofUtils.h"
+#include "ofFileUtils.h"
+
+#include <algorithm>
+
+/// shard buffer size which is handed to a writer when reached
+static const size_t s_flushSize = 256 * 1024;
+
+/// max number of jobs queued per writer before reading waits
+static const size_t s_maxJobs = 16;
+
+//--------------------------------------------------
+ofxCsvSplitter::ofxCsvSplitter() {
+	mode = ROWS;
+	col = 0;
+	shards = 1;
+	rowsPerShard = 100000;
+	header = true;
+	writers = 0;
+	failed = false;
+}
+
+/// SETUP
+
+//--------------------------------------------------
+void ofxCsvSplitter::setHashPartition(int col, size_t shards) {
+	mode = HASH;
+	this->col = max(col, 0);
+	this->shards = max(shards, (size_t)1);
+}
+
+//--------------------------------------------------
+void ofxCsvSplitter::setRangePartition(int col, const vector<double> &bounds) {
+	mode = RANGE;
+	this->col = max(col, 0);
+	this->bounds = bounds;
+	std::sort(this->bounds.begin(), this->bounds.end());
+}
+
+//--------------------------------------------------
+void ofxCsvSplitter::setRowPartition(size_t rows) {
+	mode = ROWS;
+	rowsPerShard = max(rows, (size_t)1);
+}
+
+//--------------------------------------------------
+void ofxCsvSplitter::setHeader(bool header) {
+	this->header = header;
+}
+
+//--------------------------------------------------
+void ofxCsvSplitter::setWriters(unsigned int writers) {
+	this->writers = writers;
+}
+
+/// SPLITTING
+
+//--------------------------------------------------
+bool ofxCsvSplitter::split(const string &input, const string &output,
+                           const string &separator, const string &comment) {
+	outputs.clear();
+	headerLine.clear();
+	failed = false;
+
+	ofxCsvReader reader;
+	if(!reader.open(input, separator, comment)) {
+		return false;
+	}
+	outputPath = ofToDataPath(output, true);
+	string dir = ofFilePath::getEnclosingDirectory(outputPath, false);
+	if(!ofDirectory::doesDirectoryExist(dir, false) && !ofDirectory::createDirectory(dir, false, true)) {
+		ofLogError("ofxCsvSplitter") << "Cannot split " << input << ": couldn't create " << dir;
+		return false;
+	}
+	switch(mode) {
+		case HASH:
+			outputs.resize(shards);
+			break;
+		case RANGE:
+			outputs.resize(bounds.size() + 1);
+			break;
+		case ROWS:
+			break;
+	}
+	// start writers
+	unsigned int numWriters = writers;
+	if(numWriters == 0) {
+		numWriters = min(max(std::thread::hardware_concurrency(), 1u), 4u);
+	}
+	if(mode != ROWS) {
+		numWriters = min<size_t>(numWriters, outputs.size());
+	}
+	for(unsigned int i = 0; i < numWriters; i++) {
+		threads.emplace_back(new Writer);
+		threads.back()->stopping = false;
+		threads.back()->thread = std::thread(&ofxCsvSplitter::writeThread, this, threads.back().get());
+	}
+
+	// route rows into shard buffers
+	size_t index = 0;
+	bool first = header;
+	while(reader.next() && !failed) {
+		const ofxCsvRowView &row = reader.getRow();
+		if(first) {
+			headerLine.assign(row.getLineData(), row.getLineSize());
+			headerLine += '\n';
+			first = false;
+			continue;
+		}
+		size_t number = route(row, index++);
+		if(number >= outputs.size()) { // next shard of rows, close the last
+			if(!outputs.empty()) {
+				flush(outputs.size() - 1, true);
+			}
+			outputs.resize(number + 1);
+		}
+		Shard &shard = outputs[number];
+		if(shard.path.empty()) {
+			shard.path = ofFilePath::join(dir, shardFile(outputPath, number));
+			shard.buffer = headerLine;
+			shard.open = true;
+		}
+		shard.buffer.append(row.getLineData(), row.getLineSize());
+		shard.buffer += '\n';
+		shard.rows++;
+		if(shard.buffer.size() >= s_flushSize) {
+			flush(number, false);
+		}
+	}
+	reader.close();
+
+	// write what's left & wait for the writers
+	for(size_t i = 0; i < outputs.size(); i++) {
+		if(outputs[i].open) {
+			flush(i, true);
+		}
+	}
+	for(auto &writer : threads) {
+		{
+			std::lock_guard<std::mutex> lock(writer->mutex);
+			writer->stopping = true;
+		}
+		writer->condition.notify_all();
+		writer->thread.join();
+	}
+	threads.clear();
+	if(failed) {
+		ofLogError("ofxCsvSplitter") << "Could not split " << input << ": couldn't write shards";
+		return false;
+	}
+
+	ofLogVerbose("ofxCsvSplitter") << "Split " << index << " rows from " << input
+	                               << " into " << outputs.size() << " shards";
+	return true;
+}
+
+//--------------------------------------------------
+size_t ofxCsvSplitter::getNumShards() const {
+	return outputs.size();
+}
+
+//--------------------------------------------------
+string ofxCsvSplitter::getShardPath(size_t shard) const {
+	if(shard >= outputs.size()) {
+		return "";
+	}
+	return outputs[shard].path;
+}
+
+//--------------------------------------------------
+size_t ofxCsvSplitter::getShardRows(size_t shard) const {
+	if(shard >= outputs.size()) {
+		return 0;
+	}
+	return outputs[shard].rows;
+}
+
+//--------------------------------------------------
+vector<string> ofxCsvSplitter::getShardPaths() const {
+	vector<string> paths;
+	for(auto &shard : outputs) {
+		paths.push_back(shard.path);
+	}
+	return paths;
+}
+
+//--------------------------------------------------
+string ofxCsvSplitter::shardFile(const string &output, size_t shard) {
+	string name = ofFilePath::getFileName(output);
+	string ext = ofFilePath::getFileExt(name);
+	char num[32];
+	snprintf(num, sizeof(num), ".%04zu.", shard);
+	return ofFilePath::removeExt(name) + num + (ext.empty() ? "csv" : ext);
+}
+
+// PROTECTED
+
+//--------------------------------------------------
+size_t ofxCsvSplitter::route(const ofxCsvRowView &row, size_t index) const {
+	if(mode == ROWS) {
+		return index / rowsPerShard;
+	}
+	string unquoted;
+	const char *data = "";
+	size_t size = 0;
+	if((size_t)col < row.size()) {
+		const ofxCsvFieldView &field = row[col];
+		data = field.data;
+		size = field.size;
+		if(field.quoted) {
+			field.str(unquoted);
+			data = unquoted.data();
+			size = unquoted.size();
+		}
+	}
+	if(mode == HASH) { // FNV-1a
+		uint64_t hash = 14695981039346656037ULL;
+		for(size_t i = 0; i < size; i++) {
+			hash = (hash ^ (unsigned char)data[i]) * 1099511628211ULL;
+		}
+		return hash % shards;
+	}
+	double v = 0;
+	if(!ofxCsvParse::toDouble(data, data + size, v)) {
+		return 0;
+	}
+	return std::upper_bound(bounds.begin(), bounds.end(), v) - bounds.begin();
+}
+
+//--------------------------------------------------
+void ofxCsvSplitter::flush(size_t shard, bool close) {
+	Shard &out = outputs[shard];
+	Writer &writer = *threads[shard % threads.size()];
+	Job job = {shard, out.path, std::move(out.buffer), close};
+	out.buffer.clear();
+	out.open = !close;
+	out.buffer.reserve(s_flushSize + 1024);
+	{
+		std::unique_lock<std::mutex> lock(writer.mutex);
+		writer.condition.wait(lock, [&] {return writer.jobs.size() < s_maxJobs || failed;});
+		writer.jobs.push_back(std::move(job));
+	}
+	writer.condition.notify_all();
+}
+
+//--------------------------------------------------
+void ofxCsvSplitter::writeThread(Writer *writer) {
+	while(true) {
+		Job job;
+		{
+			std::unique_lock<std::mutex> lock(writer->mutex);
+			writer->condition.wait(lock, [&] {return !writer->jobs.empty() || writer->stopping;});
+			if(writer->jobs.empty()) {
+				break;
+			}
+			job = std::move(writer->jobs.front());
+			writer->jobs.pop_front();
+		}
+		writer->condition.notify_all(); // wake reading if it was waiting
+
+		// open on first write
+		FILE *&file = writer->files[job.shard];
+		if(!file && !failed) {
+			file = fopen(job.path.c_str(), "wb");
+			if(!file) {
+				ofLogError("ofxCsvSplitter") << "Cannot write shard " << job.path;
+				failed = true;
+			}
+		}
+		if(file && !job.data.empty() && fwrite(job.data.data(), 1, job.data.size(), file) != job.data.size()) {
+			ofLogError("ofxCsvSplitter") << "Could not write shard " << job.path;
+			failed = true;
+		}
+		if(file && job.close) {
+			if(fclose(file) != 0) {
+				failed = true;
+			}
+			writer->files.erase(job.shard);
+		}
+	}
+
+	// close anything left open after a failure
+	for(auto &file : writer->files) {
+		if(file.second) {
+			fclose(file.second);
+		}
+	}
+	writer->files.clear();
+}
@@ -0,0 +1,190 @@
+/**
+ *  ofxCsvSplitter.h
+ *  Inspired and based on Ben Fry's [table class](http://benfry.com/writing/map/Table.pde)
+ *
+ *  The MIT License
+ *
+ *  Copyright (c) 2011-2019 Paul Vollmer, https://paulvollmer.net
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ *
+ *  @modified           2026.10.18
+ *  @version            0.2.1
+ */
+
+#pragma once
+
+#include "ofxCsvReader.h"
+
+#include <atomic>
+#include <deque>
+#include <map>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+/// \class ofxCsvSplitter
+/// \brief splits a CSV file into several shard files in a single pass
+///
+/// Rows are routed to a shard by hashing a key col, by numeric ranges of a
+/// key col, or every N rows. Shard files are numbered before the extension
+/// like ofxCsvRotatingWriter segments & each starts with a copy of the
+/// header row:
+///
+///     ofxCsvSplitter splitter;
+///     splitter.setHashPartition(0, 8); // 8 shards by device id
+///     splitter.split("export.csv", "shards/export.csv"); // export.0000.csv, ...
+///
+/// The input is read & tokenized once while rows are gathered into per
+/// shard buffers which are written by background writer threads, so slow
+/// disks don't hold up reading. Rows are copied as is & shards without any
+/// rows are not created.
+///
+class ofxCsvSplitter {
+
+	public:
+
+		/// partition mode
+		enum Mode {
+			HASH,  //< hash of the key col text
+			RANGE, //< numeric ranges of the key col
+			ROWS   //< every N rows
+		};
+
+		/// Constructor. Initializes and starts the class.
+		ofxCsvSplitter();
+
+	/// \section Setup
+
+		/// Split rows by the hash of a key col, so all rows with the same
+		/// key end up in the same shard.
+		///
+		/// \param col Key column number.
+		/// \param shards Number of shards.
+		void setHashPartition(int col, size_t shards);
+
+		/// Split rows by numeric ranges of a key col.
+		///
+		/// Bounds are sorted, N bounds give N+1 shards: values below
+		/// bounds[0] go to shard 0, values from bounds[0] up to bounds[1] to
+		/// shard 1, etc. Non numeric values go to shard 0.
+		///
+		/// \param col Key column number.
+		/// \param bounds Range bounds.
+		void setRangePartition(int col, const vector<double> &bounds);
+
+		/// Split rows into shards of a fixed number of rows, in order.
+		///
+		/// \param rows Number of rows per shard.
+		void setRowPartition(size_t rows);
+
+		/// Set whether the first row is a header which is copied to the top
+		/// of each shard, default true.
+		void setHeader(bool header);
+
+		/// Set the number of writer threads, default 0 for up to 4 based on
+		/// the number of hardware threads.
+		void setWriters(unsigned int writers);
+
+	/// \section Splitting
+
+		/// Split a CSV file into shards.
+		///
+		/// Creates any required folders in the output path, if needed. Skips
+		/// empty lines & lines beginning with the comment prefix.
+		///
+		/// \param input Input file path.
+		/// \param output Base output file path, shards are numbered before
+		///               the extension: output.0000.csv, output.0001.csv, ...
+		/// \param separator Field separator string, default comma ",".
+		/// \param comment Comment line prefix string, default "#".
+		/// \returns true if the file was split successfully
+		bool split(const string &input, const string &output,
+		           const string &separator=",", const string &comment="#");
+
+		/// Get the number of shards written by the last split, including
+		/// any shards without rows which were not created.
+		size_t getNumShards() const;
+
+		/// Get a shard file path from the last split, "" if the shard has no
+		/// rows & was not created.
+		string getShardPath(size_t shard) const;
+
+		/// Get the number of rows written to a shard by the last split.
+		size_t getShardRows(size_t shard) const;
+
+		/// Get the shard file paths from the last split.
+		vector<string> getShardPaths() const;
+
+		/// Get the shard file name for a shard number.
+		static string shardFile(const string &output, size_t shard);
+
+	protected:
+
+		/// output shard
+		struct Shard {
+			string path;       //< file path, "" until the first row
+			string buffer;     //< rows waiting to be written
+			size_t rows = 0;   //< number of rows
+			bool open = false; //< is the shard being written?
+		};
+
+		/// buffered rows to write to a shard
+		struct Job {
+			size_t shard; //< shard index
+			string path;  //< shard file path
+			string data;  //< rows to write
+			bool close;   //< close the shard after writing?
+		};
+
+		/// writer thread & its job queue, each shard always uses the same
+		/// writer so its rows stay in order
+		struct Writer {
+			std::thread thread;
+			std::mutex mutex;
+			std::condition_variable condition;
+			std::deque<Job> jobs;
+			std::map<size_t, FILE*> files; //< open shard files
+			bool stopping;
+		};
+
+		/// get the shard for a row
+		size_t route(const ofxCsvRowView &row, size_t index) const;
+
+		/// queue a shard's buffered rows for writing
+		void flush(size_t shard, bool close);
+
+		/// writer thread loop
+		void writeThread(Writer *writer);
+
+		Mode mode;               //< partition mode
+		int col;                 //< key column number
+		size_t shards;           //< number of hash shards
+		vector<double> bounds;   //< range bounds
+		size_t rowsPerShard;     //< rows per shard in ROWS mode
+		bool header;             //< copy the first row as a header?
+		unsigned int writers;    //< number of writer threads, 0 for auto
+
+		string outputPath;       //< base output path, absolute
+		string headerLine;       //< header row text with line ending
+		vector<Shard> outputs;   //< shards from the current or last split
+		vector<std::unique_ptr<Writer>> threads; //< writer threads
+		std::atomic<bool> failed; //< did a write fail?
+};
@@ -0,0 +1,495 @@
+/**
+ *  ofxCsvTimestamp.cpp
+ *  Inspired and based on Ben Fry's [table class](http://benfry.com/writing/map/Table.pde)
+ *
+ *  The MIT License
+ *
+ *  Copyright (c) 2011-2019 Paul Vollmer, https://paulvollmer.net
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ *
+ *  @modified           2026.10.18
+ *  @version            0.2.1
+ */
+
+#include "ofxCsvTimestamp.h"
+
+#include "ofxCsv.h"
+
+#include <cstring>
+
+// 8 chars at a time needs little endian loads
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	#define OFXCSV_SWAR 0
+#else
+	#define OFXCSV_SWAR 1
+#endif
+
+/// month name abbreviations for %b
+static const char *s_months[] = {
+	"jan", "feb", "mar", "apr", "may", "jun",
+	"jul", "aug", "sep", "oct", "nov", "dec"
+};
+
+/// skip leading whitespace
+static inline const char* skipSpace(const char *begin, const char *end) {
+	while(begin < end && isspace((unsigned char)*begin)) {
+		begin++;
+	}
+	return begin;
+}
+
+/// is a char a decimal digit?
+static inline bool isDigit(char c) {
+	return (unsigned char)(c - '0') < 10;
+}
+
+/// read an unsigned number with a min & max number of digits
+/// \returns false if there are too few digits
+static inline bool readNumber(const char *&p, const char *end, int minDigits, int maxDigits, int64_t &out) {
+	int count = 0;
+	int64_t v = 0;
+	while(count < maxDigits && p < end && isDigit(*p)) {
+		v = v * 10 + (*p - '0');
+		p++;
+		count++;
+	}
+	out = v;
+	return count >= minDigits;
+}
+
+/// read an unsigned int with a min & max number of digits
+/// \returns false if there are too few digits
+static inline bool readNumber(const char *&p, const char *end, int minDigits, int maxDigits, int &out) {
+	int64_t v;
+	bool ok = readNumber(p, end, minDigits, maxDigits, v);
+	out = (int)v;
+	return ok;
+}
+
+/// read an expected char
+/// \returns false if the char doesn't match
+static inline bool readChar(const char *&p, const char *end, char c) {
+	if(p < end && *p == c) {
+		p++;
+		return true;
+	}
+	return false;
+}
+
+/// read fractional second digits as nanoseconds, digits after the 9th
+/// are skipped
+/// \returns false if there are no digits
+static bool readFraction(const char *&p, const char *end, int &nanosecond) {
+	const char *start = p;
+	int v = 0, count = 0;
+	for(; p < end && isDigit(*p); p++) {
+		if(count < 9) {
+			v = v * 10 + (*p - '0');
+			count++;
+		}
+	}
+	static const int scale[] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000};
+	nanosecond = v * scale[9 - count];
+	return p > start;
+}
+
+/// read a 'Z' or "+HH", "+HHMM", or "+HH:MM" zone as a UTC offset in minutes
+/// \returns false if the zone is malformed
+static bool readZone(const char *&p, const char *end, int &offset) {
+	if(p < end && (*p == 'Z' || *p == 'z')) {
+		p++;
+		offset = 0;
+		return true;
+	}
+	if(p >= end || (*p != '+' && *p != '-')) {
+		return false;
+	}
+	int sign = (*p == '-') ? -1 : 1;
+	const char *c = p + 1;
+	int hours = 0, minutes = 0;
+	if(!readNumber(c, end, 2, 2, hours) || hours > 23) {
+		return false;
+	}
+	const char *colon = c;
+	readChar(colon, end, ':');
+	if(end - colon >= 2 && isDigit(colon[0]) && isDigit(colon[1])) {
+		c = colon;
+		readNumber(c, end, 2, 2, minutes);
+		if(minutes > 59) {
+			return false;
+		}
+	}
+	p = c;
+	offset = sign * (hours * 60 + minutes);
+	return true;
+}
+
+/// read an English month name or abbreviation, case insensitive
+/// \returns false if the name isn't known
+static bool readMonthName(const char *&p, const char *end, int &month) {
+	if(end - p < 3) {
+		return false;
+	}
+	char name[3];
+	for(int i = 0; i < 3; i++) {
+		name[i] = tolower((unsigned char)p[i]);
+	}
+	for(int m = 0; m < 12; m++) {
+		if(memcmp(name, s_months[m], 3) == 0) {
+			month = m + 1;
+			p += 3;
+			while(p < end && isalpha((unsigned char)*p)) { // full name
+				p++;
+			}
+			return true;
+		}
+	}
+	return false;
+}
+
+#if OFXCSV_SWAR
+/// check & convert the fixed layout "YYYY-MM-DDTHH:MM:SS" with two 8 char
+/// loads, p must have at least 19 chars
+/// \returns false if the text doesn't fit the layout
+static inline bool readFixedLayout(const char *p, int64_t &year, int &month, int &day,
+                                   int &hour, int &minute, int &second) {
+	if((p[10] != 'T' && p[10] != ' ' && p[10] != 't') ||
+	   p[16] != ':' || !isDigit(p[17]) || !isDigit(p[18])) {
+		return false;
+	}
+	uint64_t dateChars, timeChars;
+	memcpy(&dateChars, p, 8);     // "YYYY-MM-"
+	memcpy(&timeChars, p + 8, 8); // "DDTHH:MM"
+
+	// digits become 0-9 & separators 0, the 'T' is masked out
+	dateChars ^= 0x2D30302D30303030ULL;
+	timeChars = (timeChars ^ 0x30303A3030003030ULL) & ~0x0000000000FF0000ULL;
+	if((dateChars & 0xFF0000FF00000000ULL) || (timeChars & 0x0000FF0000000000ULL)) {
+		return false;
+	}
+	if(((((dateChars & 0x7F7F7F7F7F7F7F7FULL) + 0x7676767676767676ULL) | dateChars) |
+	    (((timeChars & 0x7F7F7F7F7F7F7F7FULL) + 0x7676767676767676ULL) | timeChars)) & 0x8080808080808080ULL) {
+		return false; // a byte > 9
+	}
+
+	// each byte becomes the value of its digit & the following digit
+	dateChars = dateChars * 10 + (dateChars >> 8);
+	timeChars = timeChars * 10 + (timeChars >> 8);
+	year = (int64_t)(dateChars & 0xFF) * 100 + ((dateChars >> 16) & 0xFF);
+	month = (dateChars >> 40) & 0xFF;
+	day = timeChars & 0xFF;
+	hour = (timeChars >> 24) & 0xFF;
+	minute = (timeChars >> 48) & 0xFF;
+	second = (p[17] - '0') * 10 + (p[18] - '0');
+	return true;
+}
+#endif
+
+/// match text against a format string
+/// \returns false if the text doesn't match
+static bool matchFormat(const char *format, const char *&p, const char *end,
+                        int64_t &year, int &month, int &day, int &hour, int &minute, int &second,
+                        int &nanosecond, int &offset, bool &epoch, int64_t &seconds) {
+	for(const char *f = format; *f; f++) {
+		if(isspace((unsigned char)*f)) {
+			p = skipSpace(p, end);
+			continue;
+		}
+		if(*f != '%' || f[1] == '\0') {
+			if(!readChar(p, end, *f)) {
+				return false;
+			}
+			continue;
+		}
+		bool ok = true;
+		switch(*(++f)) {
+			case 'Y':
+				ok = readNumber(p, end, 4, 4, year);
+				break;
+			case 'y':
+				ok = readNumber(p, end, 2, 2, year);
+				year += (year < 69) ? 2000 : 1900;
+				break;
+			case 'm':
+				ok = readNumber(p, end, 1, 2, month);
+				break;
+			case 'b': case 'B': case 'h':
+				ok = readMonthName(p, end, month);
+				break;
+			case 'd': case 'e':
+				ok = readNumber(p, end, 1, 2, day);
+				break;
+			case 'H':
+				ok = readNumber(p, end, 1, 2, hour);
+				break;
+			case 'M':
+				ok = readNumber(p, end, 1, 2, minute);
+				break;
+			case 'S':
+				ok = readNumber(p, end, 1, 2, second);
+				break;
+			case 'f':
+				ok = readFraction(p, end, nanosecond);
+				break;
+			case 'z':
+				ok = readZone(p, end, offset);
+				break;
+			case 's': {
+				bool negative = readChar(p, end, '-');
+				ok = readNumber(p, end, 1, 18, seconds);
+				seconds = negative ? -seconds : seconds;
+				epoch = true;
+				break;
+			}
+			case 'F':
+				ok = matchFormat("%Y-%m-%d", p, end, year, month, day, hour, minute, second,
+				                 nanosecond, offset, epoch, seconds);
+				break;
+			case 'T':
+				ok = matchFormat("%H:%M:%S", p, end, year, month, day, hour, minute, second,
+				                 nanosecond, offset, epoch, seconds);
+				break;
+			case '%':
+				ok = readChar(p, end, '%');
+				break;
+			default:
+				ok = false;
+				break;
+		}
+		if(!ok) {
+			return false;
+		}
+	}
+	return true;
+}
+
+//--------------------------------------------------
+ofxCsvTimestamp::ofxCsvTimestamp(const string &format, Unit unit) {
+	this->format = format;
+	this->unit = unit;
+	utcOffset = 0;
+}
+
+/// SETUP
+
+//--------------------------------------------------
+void ofxCsvTimestamp::setFormat(const string &format) {
+	this->format = format;
+}
+
+//--------------------------------------------------
+string ofxCsvTimestamp::getFormat() const {
+	return format;
+}
+
+//--------------------------------------------------
+void ofxCsvTimestamp::setUnit(Unit unit) {
+	this->unit = unit;
+}
+
+//--------------------------------------------------
+ofxCsvTimestamp::Unit ofxCsvTimestamp::getUnit() const {
+	return unit;
+}
+
+//--------------------------------------------------
+void ofxCsvTimestamp::setUtcOffset(int minutes) {
+	utcOffset = minutes;
+}
+
+//--------------------------------------------------
+int ofxCsvTimestamp::getUtcOffset() const {
+	return utcOffset;
+}
+
+/// PARSING
+
+//--------------------------------------------------
+bool ofxCsvTimestamp::parse(const char *begin, const char *end, int64_t &out) const {
+	Fields fields = {1970, 1, 1, 0, 0, 0, 0, utcOffset, false, 0};
+	bool ok = format.empty() ? parseIso(begin, end, fields) : parseFormat(begin, end, fields);
+	return ok && toTime(fields, out);
+}
+
+//--------------------------------------------------
+bool ofxCsvTimestamp::parse(const string &text, int64_t &out) const {
+	return parse(text.data(), text.data() + text.size(), out);
+}
+
+//--------------------------------------------------
+size_t ofxCsvTimestamp::parse(const ofxCsv &csv, int col, vector<int64_t> &out, int firstRow, int64_t missing) const {
+	out.clear();
+	out.reserve(csv.getNumRows());
+	size_t count = 0, index = 0;
+	for(auto &row : csv) {
+		if(index++ < (size_t)max(firstRow, 0)) {
+			continue;
+		}
+		int64_t v = missing;
+		if(col >= 0 && (size_t)col < row.size()) {
+			const string &text = *(row.begin() + col);
+			if(parse(text.data(), text.data() + text.size(), v)) {
+				count++;
+			}
+		}
+		out.push_back(v);
+	}
+	return count;
+}
+
+/// UTILS
+
+//--------------------------------------------------
+string ofxCsvTimestamp::toString(int64_t time) const {
+	static const int64_t scales[] = {1, 1000, 1000000, 1000000000};
+	static const int digits[] = {0, 3, 6, 9};
+	int64_t scale = scales[unit];
+
+	// floor to whole seconds & days so times before 1970 work
+	int64_t seconds = time / scale, fraction = time % scale;
+	if(fraction < 0) {
+		seconds--;
+		fraction += scale;
+	}
+	int64_t days = seconds / 86400, rest = seconds % 86400;
+	if(rest < 0) {
+		days--;
+		rest += 86400;
+	}
+	int64_t year;
+	int month, day;
+	civilFromDays(days, year, month, day);
+
+	char text[64];
+	int size = snprintf(text, sizeof(text), "%04lld-%02d-%02dT%02d:%02d:%02d",
+	                    (long long)year, month, day, (int)(rest / 3600), (int)(rest / 60 % 60), (int)(rest % 60));
+	if(digits[unit] > 0) {
+		size += snprintf(text + size, sizeof(text) - size, ".%0*lld", digits[unit], (long long)fraction);
+	}
+	snprintf(text + size, sizeof(text) - size, "Z");
+	return text;
+}
+
+//--------------------------------------------------
+int64_t ofxCsvTimestamp::daysFromCivil(int64_t year, int month, int day) {
+	// Howard Hinnant's days_from_civil, with years starting in March so
+	// leap days fall at the end
+	year -= (month <= 2);
+	int64_t era = (year >= 0 ? year : year - 399) / 400;
+	int64_t yearOfEra = year - era * 400;                                // [0, 399]
+	int64_t dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1; // [0, 365]
+	int64_t dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear; // [0, 146096]
+	return era * 146097 + dayOfEra - 719468;
+}
+
+//--------------------------------------------------
+void ofxCsvTimestamp::civilFromDays(int64_t days, int64_t &year, int &month, int &day) {
+	days += 719468;
+	int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+	int64_t dayOfEra = days - era * 146097;                                                      // [0, 146096]
+	int64_t yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365; // [0, 399]
+	int64_t dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);          // [0, 365]
+	int64_t monthIndex = (5 * dayOfYear + 2) / 153;                                              // [0, 11]
+	day = (int)(dayOfYear - (153 * monthIndex + 2) / 5 + 1);
+	month = (int)(monthIndex < 10 ? monthIndex + 3 : monthIndex - 9);
+	year = yearOfEra + era * 400 + (month <= 2);
+}
+
+// PROTECTED
+
+//--------------------------------------------------
+bool ofxCsvTimestamp::parseIso(const char *begin, const char *end, Fields &fields) const {
+	const char *p = skipSpace(begin, end);
+#if OFXCSV_SWAR
+	if(end - p >= 19 && readFixedLayout(p, fields.year, fields.month, fields.day,
+	                                    fields.hour, fields.minute, fields.second)) {
+		p += 19;
+	}
+	else
+#endif
+	{
+		// date
+		if(!readNumber(p, end, 4, 4, fields.year) || !readChar(p, end, '-') ||
+		   !readNumber(p, end, 2, 2, fields.month) || !readChar(p, end, '-') ||
+		   !readNumber(p, end, 2, 2, fields.day)) {
+			return false;
+		}
+
+		// optional time
+		if(end - p >= 2 && (*p == 'T' || *p == 't' || *p == ' ') && isDigit(p[1])) {
+			p++;
+			if(!readNumber(p, end, 2, 2, fields.hour) || !readChar(p, end, ':') ||
+			   !readNumber(p, end, 2, 2, fields.minute)) {
+				return false;
+			}
+			if(end - p >= 2 && *p == ':' && isDigit(p[1])) {
+				p++;
+				if(!readNumber(p, end, 2, 2, fields.second)) {
+					return false;
+				}
+			}
+		}
+	}
+
+	// optional fractional seconds & zone
+	if(end - p >= 2 && (*p == '.' || *p == ',') && isDigit(p[1])) {
+		p++;
+		readFraction(p, end, fields.nanosecond);
+	}
+	if(p < end && (*p == 'Z' || *p == 'z' || *p == '+' || *p == '-')) {
+		return readZone(p, end, fields.offset);
+	}
+	return true;
+}
+
+//--------------------------------------------------
+bool ofxCsvTimestamp::parseFormat(const char *begin, const char *end, Fields &fields) const {
+	const char *p = skipSpace(begin, end);
+	return matchFormat(format.c_str(), p, end, fields.year, fields.month, fields.day,
+	                   fields.hour, fields.minute, fields.second, fields.nanosecond,
+	                   fields.offset, fields.epoch, fields.seconds);
+}
+
+//--------------------------------------------------
+bool ofxCsvTimestamp::toTime(const Fields &fields, int64_t &out) const {
+	static const int64_t scales[] = {1, 1000, 1000000, 1000000000};
+	static const int daysInMonth[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+	int64_t seconds = fields.seconds;
+	if(!fields.epoch) {
+		if(fields.month < 1 || fields.month > 12 || fields.day < 1 ||
+		   fields.hour > 23 || fields.minute > 59 || fields.second > 60) { // 60: leap second
+			return false;
+		}
+		bool leap = (fields.year % 4 == 0 && fields.year % 100 != 0) || fields.year % 400 == 0;
+		if(fields.day > daysInMonth[fields.month - 1] + (leap && fields.month == 2)) {
+			return false;
+		}
+		seconds = daysFromCivil(fields.year, fields.month, fields.day) * 86400 +
+		          fields.hour * 3600 + fields.minute * 60 + fields.second -
+		          (int64_t)fields.offset * 60;
+	}
+	int64_t scale = scales[unit];
+	if(seconds >= std::numeric_limits<int64_t>::max() / scale ||
+	   seconds <= std::numeric_limits<int64_t>::min() / scale) {
+		return false; // ie. nanoseconds outside 1677 - 2262
+	}
+	out = seconds * scale + fields.nanosecond / (1000000000 / scale);
+	return true;
+}
@@ -0,0 +1,184 @@
+/**
+ *  ofxCsvTimestamp.h
+ *  Inspired and based on Ben Fry's [table class](http://benfry.com/writing/map/Table.pde)
+ *
+ *  The MIT License
+ *
+ *  Copyright (c) 2011-2019 Paul Vollmer, https://paulvollmer.net
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ *
+ *  @modified           2026.10.18
+ *  @version            0.2.1
+ */
+
+#pragma once
+
+#include "ofConstants.h"
+
+#include <limits>
+
+class ofxCsv;
+
+/// \class ofxCsvTimestamp
+/// \brief parses date & time fields into int64 epoch times
+///
+/// Converts ISO 8601 text straight to seconds, milli-, micro-, or
+/// nanoseconds since 1970-01-01T00:00:00Z without strptime() or temporary
+/// structs:
+///
+///     ofxCsvTimestamp timestamp; // ISO 8601, microseconds
+///     vector<int64_t> times;
+///     timestamp.parse(csv, 0, times, 1); // time col, skip header row
+///
+///     ofxCsvTimestamp european("%d/%m/%Y %H:%M:%S", ofxCsvTimestamp::MILLISECONDS);
+///     int64_t ms;
+///     european.parse("25/12/2024 18:30:00", ms);
+///
+/// The default format accepts "2024-12-25", "2024-12-25T18:30",
+/// "2024-12-25 18:30:00", & "2024-12-25T18:30:00.123456789+01:00", with
+/// a ',' or '.' before fractional seconds & a 'Z', "+HH", "+HHMM", or
+/// "+HH:MM" zone. The common fixed layout "YYYY-MM-DDTHH:MM:SS" is checked
+/// & converted 8 chars at a time.
+///
+/// Times without a zone use the UTC offset, default 0. Leading whitespace
+/// is skipped & parsing stops after the last char which fits the format,
+/// like ofxCsvParse.
+///
+class ofxCsvTimestamp {
+
+	public:
+
+		/// epoch time unit
+		enum Unit {
+			SECONDS,
+			MILLISECONDS,
+			MICROSECONDS,
+			NANOSECONDS //< limited to the years 1677 - 2262
+		};
+
+		/// Constructor.
+		///
+		/// \param format Format string, default "" for ISO 8601. See setFormat().
+		/// \param unit Epoch time unit, default MICROSECONDS.
+		ofxCsvTimestamp(const string &format="", Unit unit=MICROSECONDS);
+
+	/// \section Setup
+
+		/// Set the format string, "" for ISO 8601.
+		///
+		/// Supports a subset of the strptime() conversions:
+		///   * %Y: 4 digit year
+		///   * %y: 2 digit year, 69-99 are 1969-1999 & 00-68 are 2000-2068
+		///   * %m, %d, %H, %M, %S: 1 or 2 digit month, day, hour, min, & sec
+		///   * %b: English month name or abbreviation, case insensitive
+		///   * %f: fractional seconds, up to 9 digits are used
+		///   * %z: 'Z' or a "+HH", "+HHMM", or "+HH:MM" zone
+		///   * %s: seconds since the epoch
+		///   * %F: "%Y-%m-%d", %T: "%H:%M:%S", %%: a '%'
+		///
+		/// Whitespace matches any amount of whitespace & other chars must
+		/// match exactly.
+		void setFormat(const string &format);
+
+		/// Get the format string, "" for ISO 8601.
+		string getFormat() const;
+
+		/// Set the epoch time unit, default MICROSECONDS.
+		void setUnit(Unit unit);
+
+		/// Get the epoch time unit.
+		Unit getUnit() const;
+
+		/// Set the UTC offset in minutes for times without a zone, ie. 60
+		/// for CET, default 0.
+		void setUtcOffset(int minutes);
+
+		/// Get the UTC offset in minutes for times without a zone.
+		int getUtcOffset() const;
+
+	/// \section Parsing
+
+		/// Parse a time.
+		/// \returns true if a time was parsed, out is unchanged if not
+		bool parse(const char *begin, const char *end, int64_t &out) const;
+
+		/// Parse a time from a string.
+		/// \returns true if a time was parsed, out is unchanged if not
+		bool parse(const string &text, int64_t &out) const;
+
+		/// Parse a col of a table.
+		///
+		/// \param csv Table to parse from.
+		/// \param col Column number.
+		/// \param out Cleared & set to one time per row from firstRow on.
+		/// \param firstRow First row to parse, ie. 1 to skip a header row.
+		/// \param missing Value for missing or unparsable fields, default
+		///                INT64_MIN.
+		/// \returns the number of fields parsed successfully
+		size_t parse(const ofxCsv &csv, int col, vector<int64_t> &out, int firstRow=0,
+		             int64_t missing=std::numeric_limits<int64_t>::min()) const;
+
+	/// \section Utils
+
+		/// Format a time in the current unit as ISO 8601 UTC, ie.
+		/// "2024-12-25T17:30:00.123456Z", with as many fractional digits
+		/// as the unit has.
+		string toString(int64_t time) const;
+
+		/// Get the number of days from 1970-01-01 to a proleptic
+		/// Gregorian date.
+		static int64_t daysFromCivil(int64_t year, int month, int day);
+
+		/// Get the proleptic Gregorian date a number of days after
+		/// 1970-01-01.
+		static void civilFromDays(int64_t days, int64_t &year, int &month, int &day);
+
+	protected:
+
+		/// broken down time, in the zone of the text
+		struct Fields {
+			int64_t year;    //< year
+			int month;       //< month 1-12
+			int day;         //< day 1-31
+			int hour;        //< hour 0-23
+			int minute;      //< min 0-59
+			int second;      //< sec 0-60
+			int nanosecond;  //< fractional seconds in ns
+			int offset;      //< zone UTC offset in minutes
+			bool epoch;      //< seconds since the epoch set by %s?
+			int64_t seconds; //< %s seconds since the epoch
+		};
+
+		/// parse ISO 8601 text
+		/// \returns true if a date was found
+		bool parseIso(const char *begin, const char *end, Fields &fields) const;
+
+		/// parse text with the format string
+		/// \returns true if the whole format matched
+		bool parseFormat(const char *begin, const char *end, Fields &fields) const;
+
+		/// check ranges & convert fields to the current unit
+		/// \returns false if a field or the result is out of range
+		bool toTime(const Fields &fields, int64_t &out) const;
+
+		string format; //< format string, "" for ISO 8601
+		Unit unit;     //< epoch time unit
+		int utcOffset; //< UTC offset in minutes for times without a zone
+};
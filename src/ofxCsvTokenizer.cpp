@@ -0,0 +1,247 @@
+/**
+ *  ofxCsvTokenizer.cpp
+ *  Inspired and based on Ben Fry's [table class](http://benfry.com/writing/map/Table.pde)
+ *
+ *  The MIT License
+ *
+ *  Copyright (c) 2011-2019 Paul Vollmer, https://paulvollmer.net
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ *
+ *  @modified           2026.10.18
+ *  @version            0.2.1
+ */
+
+#include "ofxCsvTokenizer.h"
+
+#include <cstring>
+
+/// FIELD VIEW
+
+//--------------------------------------------------
+string ofxCsvFieldView::str() const {
+	string out;
+	str(out);
+	return out;
+}
+
+//--------------------------------------------------
+void ofxCsvFieldView::str(string &out) const {
+	if(quoted) {
+		ofxCsvTokenizer::unquote(data, size, out);
+	}
+	else {
+		out.assign(data, size);
+	}
+}
+
+//--------------------------------------------------
+string ofxCsvFieldView::raw() const {
+	return string(data, size);
+}
+
+//--------------------------------------------------
+bool ofxCsvFieldView::empty() const {
+	return size == 0;
+}
+
+/// TOKENIZER
+
+//--------------------------------------------------
+ofxCsvTokenizer::ofxCsvTokenizer(const string &separator) {
+	setSeparator(separator);
+}
+
+//--------------------------------------------------
+void ofxCsvTokenizer::setSeparator(const string &separator) {
+	this->separator = separator.empty() ? "," : separator;
+}
+
+//--------------------------------------------------
+string ofxCsvTokenizer::getSeparator() const {
+	return separator;
+}
+
+//--------------------------------------------------
+size_t ofxCsvTokenizer::split(const char *line, size_t size, vector<ofxCsvFieldView> &fields) const {
+	fields.clear();
+	const char *end = line + size;
+	const char sepStart = separator[0];
+	const size_t sepSize = separator.size();
+
+	// fast path: no quotes, just look for separators
+	if(!memchr(line, '"', size)) {
+		const char *start = line;
+		const char *c = line;
+		while((c = (const char *)memchr(c, sepStart, end - c)) != nullptr) {
+			if(sepSize == 1 || ((size_t)(end - c) >= sepSize && memcmp(c, separator.data(), sepSize) == 0)) {
+				fields.push_back(ofxCsvFieldView(start, c - start, false));
+				c += sepSize;
+				start = c;
+			}
+			else {
+				c++;
+			}
+		}
+		fields.push_back(ofxCsvFieldView(start, end - start, false));
+		return fields.size();
+	}
+
+	// quotes: separators inside quotes are part of the field
+	const char *start = line;
+	bool inQuotes = false, quoted = false;
+	for(const char *c = line; c < end; c++) {
+		if(*c == '"') {
+			inQuotes = !inQuotes;
+			quoted = true;
+		}
+		else if(!inQuotes && *c == sepStart &&
+		        (sepSize == 1 || ((size_t)(end - c) >= sepSize && memcmp(c, separator.data(), sepSize) == 0))) {
+			fields.push_back(ofxCsvFieldView(start, c - start, quoted));
+			c += sepSize - 1;
+			start = c + 1;
+			quoted = false;
+		}
+	}
+	fields.push_back(ofxCsvFieldView(start, end - start, quoted));
+	return fields.size();
+}
+
+//--------------------------------------------------
+const char* ofxCsvTokenizer::nextLine(const char *begin, const char *end, const char *&lineEnd) {
+	const char *newline = (const char *)memchr(begin, '\n', end - begin);
+	const char *next = newline ? newline + 1 : end;
+	lineEnd = newline ? newline : end;
+	if(lineEnd > begin && *(lineEnd-1) == '\r') {
+		lineEnd--;
+	}
+	return next;
+}
+
+//--------------------------------------------------
+bool ofxCsvTokenizer::validate(const char *line, size_t size, size_t expectedCols, ofxCsvError &error) const {
+	enum {
+		FieldStart,  // start of a field
+		Unquoted,    // a regular field: hello
+		Quoted,      // a quoted field: "hello"
+		QuotedQuote  // quote inside a quoted field: "hello" or ""
+	} state = FieldStart;
+	const char *end = line + size;
+	const char sepStart = separator[0];
+	const size_t sepSize = separator.size();
+	const char *quote = nullptr; // opening quote of the current field
+	size_t field = 0;
+
+	// set the error position & return false
+	auto fail = [&](ofxCsvError::Type type, const char *at) {
+		error.type = type;
+		error.col = (at - line) + 1;
+		error.field = field;
+		return false;
+	};
+
+	for(const char *c = line; c < end; c++) {
+		if(state != Quoted && *c == sepStart &&
+		   (sepSize == 1 || ((size_t)(end - c) >= sepSize && memcmp(c, separator.data(), sepSize) == 0))) {
+			c += sepSize - 1;
+			field++;
+			if(expectedCols > 0 && field >= expectedCols) {
+				return fail(ofxCsvError::COLUMN_COUNT, c + 1);
+			}
+			state = FieldStart;
+			continue;
+		}
+		switch(state) {
+			case FieldStart:
+				if(*c == '"') {
+					quote = c;
+					state = Quoted;
+				}
+				else {
+					state = Unquoted;
+				}
+				break;
+			case Unquoted:
+				if(*c == '"') {
+					return fail(ofxCsvError::STRAY_QUOTE, c);
+				}
+				break;
+			case Quoted:
+				if(*c == '"') {
+					state = QuotedQuote;
+				}
+				break;
+			case QuotedQuote:
+				if(*c == '"') { // "" -> "
+					state = Quoted;
+				}
+				else {
+					return fail(ofxCsvError::TEXT_AFTER_QUOTE, c);
+				}
+				break;
+		}
+	}
+	if(state == Quoted) {
+		return fail(ofxCsvError::UNTERMINATED_QUOTE, quote);
+	}
+	if(expectedCols > 0 && field + 1 < expectedCols) {
+		field++;
+		return fail(ofxCsvError::COLUMN_COUNT, end);
+	}
+	return true;
+}
+
+//--------------------------------------------------
+void ofxCsvTokenizer::unquote(const char *data, size_t size, string &out) {
+	enum {
+		UnquotedField, // a regular field: hello
+		QuotedField,   // a quoted field: "hello"
+		QuotedQuote    // quote inside a quoted field: ""hello""
+	} state = UnquotedField;
+	out.clear();
+	for(const char *c = data; c < data + size; c++) {
+		switch(state) {
+			case UnquotedField:
+				if(*c == '"') {
+					state = QuotedField;
+				}
+				else {
+					out += *c;
+				}
+				break;
+			case QuotedField:
+				if(*c == '"') {
+					state = QuotedQuote;
+				}
+				else {
+					out += *c;
+				}
+				break;
+			case QuotedQuote:
+				if(*c == '"') { // "" -> "
+					out += '"';
+					state = QuotedField;
+				}
+				else { // end of quote, the char is dropped like fromString()
+					state = UnquotedField;
+				}
+				break;
+		}
+	}
+}
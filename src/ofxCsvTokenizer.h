@@ -0,0 +1,125 @@
+/**
+ *  ofxCsvTokenizer.h
+ *  Inspired and based on Ben Fry's [table class](http://benfry.com/writing/map/Table.pde)
+ *
+ *  The MIT License
+ *
+ *  Copyright (c) 2011-2019 Paul Vollmer, https://paulvollmer.net
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *  
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *  
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ *
+ *  @modified           2026.10.18
+ *  @version            0.2.1
+ */
+
+#pragma once
+
+#include "ofConstants.h"
+#include "ofxCsvError.h"
+
+/// \class ofxCsvFieldView
+/// \brief a field inside a row string, without copying it
+///
+/// Points into the tokenized text which must outlive the view. Quoted
+/// fields keep their quotes until converted with str().
+struct ofxCsvFieldView {
+
+	const char *data; //< start of the raw field text
+	size_t size;      //< raw field text size
+	bool quoted;      //< does the raw text contain quotes?
+
+	ofxCsvFieldView() : data(nullptr), size(0), quoted(false) {}
+	ofxCsvFieldView(const char *data, size_t size, bool quoted) :
+		data(data), size(size), quoted(quoted) {}
+
+	/// Get the field text with quotes removed, like ofxCsvRow::fromString().
+	string str() const;
+
+	/// Set a string to the field text with quotes removed, reusing its
+	/// storage.
+	void str(string &out) const;
+
+	/// Get the raw field text without removing quotes.
+	string raw() const;
+
+	/// Is the raw field text empty?
+	bool empty() const;
+};
+
+/// \class ofxCsvTokenizer
+/// \brief splits row strings into field views without allocating strings
+///
+/// Follows the same quoting rules as ofxCsvRow::fromString(). Lines without
+/// quotes take a fast path which only searches for separators.
+class ofxCsvTokenizer {
+
+	public:
+
+		/// Constructor.
+		///
+		/// \param separator Field separator string, default comma ",".
+		ofxCsvTokenizer(const string &separator=",");
+
+		/// Set the field separator string, default comma ",".
+		void setSeparator(const string &separator);
+
+		/// Get the field separator string.
+		string getSeparator() const;
+
+		/// Split a line into fields.
+		///
+		/// \param line Line text, without the line ending.
+		/// \param size Line text size.
+		/// \param fields Cleared & filled with views into the line text.
+		/// \returns the number of fields, always at least 1
+		size_t split(const char *line, size_t size, vector<ofxCsvFieldView> &fields) const;
+
+		/// Find the next line in a block of text.
+		///
+		/// \param begin Start of the text.
+		/// \param end End of the text.
+		/// \param lineEnd Set to the end of the line, excluding any "\r\n" or "\n".
+		/// \returns the start of the following line or end
+		static const char* nextLine(const char *begin, const char *end, const char *&lineEnd);
+
+		/// Check a line for malformed quotes & an unexpected number of fields.
+		///
+		/// Slower than split() as it looks at every char, so it's meant to
+		/// be run only on lines which a cheaper check has flagged, ie. lines
+		/// containing quotes or with the wrong number of fields.
+		///
+		/// \param line Line text, without the line ending.
+		/// \param size Line text size.
+		/// \param expectedCols Expected number of fields, 0 to skip the check.
+		/// \param error Set to the first error found, col & field are
+		///              relative to the line.
+		/// \returns true if the line is well formed
+		bool validate(const char *line, size_t size, size_t expectedCols, ofxCsvError &error) const;
+
+		/// Remove quotes from raw field text, like ofxCsvRow::fromString().
+		///
+		/// \param data Raw field text.
+		/// \param size Raw field text size.
+		/// \param out Set to the unquoted text.
+		static void unquote(const char *data, size_t size, string &out);
+
+	protected:
+
+		string separator; //< field separator, default: comma ","
+};